@@ -77,6 +77,8 @@ echo -e "${GRAY}─────────────────────
 # Configuration
 # =============================================================================
 BUILD_TYPE="${1:-Release}"
+# Extra CMake options, e.g. DEMO_CMAKE_ARGS="-DDEMO_STATS_HUD=ON" ./build_demo.sh
+DEMO_CMAKE_ARGS="${DEMO_CMAKE_ARGS:-}"
 DEMO_DIR="$PROJECT_ROOT/examples/sdl_demo"
 BUILD_DIR="$DEMO_DIR/build"
 TOOLCHAIN_FILE="$PROJECT_ROOT/tools/zig-toolchain.cmake"
@@ -91,6 +93,7 @@ mkdir -p "$BUILD_DIR"
 
 NEED_CONFIGURE=false
 [[ ! -f "$BUILD_DIR/CMakeCache.txt" ]] && NEED_CONFIGURE=true
+[[ -n "$DEMO_CMAKE_ARGS" ]] && NEED_CONFIGURE=true
 
 if $NEED_CONFIGURE; then
     start_spinner "Configuring CMake..."
@@ -100,6 +103,7 @@ if $NEED_CONFIGURE; then
         -DCMAKE_BUILD_TYPE="$BUILD_TYPE" \
         -G "Ninja" \
         -Wno-dev \
+        $DEMO_CMAKE_ARGS \
         > "$BUILD_DIR/cmake_configure.log" 2>&1 || {
         stop_spinner
         echo -e "  ${CROSS} CMake configure failed"
@@ -25,8 +25,9 @@
    COLOR SETTINGS
  *====================*/
 
-/** Color depth: 1 (I1), 8 (L8), 16 (RGB565), 24 (RGB888), 32 (XRGB8888) */
-#define LV_COLOR_DEPTH 32
+/** Color depth: 1 (I1), 8 (L8), 16 (RGB565), 24 (RGB888), 32 (XRGB8888)
+ *  16: same as the device display */
+#define LV_COLOR_DEPTH 16
 
 /*=========================
    STDLIB WRAPPER SETTINGS
@@ -39,7 +40,12 @@
  * - LV_STDLIB_RTTHREAD:    RT-Thread implementation
  * - LV_STDLIB_CUSTOM:      Implement the functions externally
  */
-#define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+#ifdef DEMO_BENCH
+    /* Counting allocator for --bench (src/bench/BenchAlloc.cpp) */
+    #define LV_USE_STDLIB_MALLOC    LV_STDLIB_CUSTOM
+#else
+    #define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+#endif
 
 /** Possible values
  * - LV_STDLIB_BUILTIN:     LVGL's built in implementation
@@ -106,7 +112,16 @@
  * - LV_OS_MQX
  * - LV_OS_SDL2
  * - LV_OS_CUSTOM */
-#define LV_USE_OS   LV_OS_NONE
+/* DEMO_DRAW_THREADS > 1 (CMake): render with that many SW draw threads */
+#if defined(DEMO_DRAW_THREADS) && DEMO_DRAW_THREADS > 1
+    #ifdef _WIN32
+        #define LV_USE_OS   LV_OS_WINDOWS
+    #else
+        #define LV_USE_OS   LV_OS_PTHREAD
+    #endif
+#else
+    #define LV_USE_OS   LV_OS_NONE
+#endif
 
 #if LV_USE_OS == LV_OS_CUSTOM
     #define LV_OS_CUSTOM_INCLUDE <stdint.h>
@@ -191,7 +206,11 @@
     /** Set number of draw units.
      *  - > 1 requires operating system to be enabled in `LV_USE_OS`.
      *  - > 1 means multiple threads will render the screen in parallel. */
-    #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+    #if defined(DEMO_DRAW_THREADS) && DEMO_DRAW_THREADS > 1
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    DEMO_DRAW_THREADS
+    #else
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+    #endif
 
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC      0
@@ -1059,10 +1078,15 @@
     #endif
 
     /** 1: Show CPU usage and FPS count.
-     *  - Requires `LV_USE_SYSMON = 1` */
-    #define LV_USE_PERF_MONITOR 0
+     *  - Requires `LV_USE_SYSMON = 1`
+     *  - Enabled by the demo's DEMO_STATS_HUD option (shown in the HUD strip) */
+    #ifdef DEMO_STATS_HUD
+        #define LV_USE_PERF_MONITOR 1
+    #else
+        #define LV_USE_PERF_MONITOR 0
+    #endif
     #if LV_USE_PERF_MONITOR
-        #define LV_USE_PERF_MONITOR_POS LV_ALIGN_BOTTOM_RIGHT
+        #define LV_USE_PERF_MONITOR_POS LV_ALIGN_TOP_LEFT
 
         /** 0: Displays performance data on the screen; 1: Prints performance data using log. */
         #define LV_USE_PERF_MONITOR_LOG_MODE 0
@@ -1070,22 +1094,32 @@
 
     /** 1: Show used memory and memory fragmentation.
      *     - Requires `LV_USE_STDLIB_MALLOC = LV_STDLIB_BUILTIN`
-     *     - Requires `LV_USE_SYSMON = 1`*/
-    #define LV_USE_MEM_MONITOR 0
+     *     - Requires `LV_USE_SYSMON = 1`
+     *     - Enabled by the demo's DEMO_STATS_HUD option (not with DEMO_BENCH) */
+    #if defined(DEMO_STATS_HUD) && !defined(DEMO_BENCH)
+        #define LV_USE_MEM_MONITOR 1
+    #else
+        #define LV_USE_MEM_MONITOR 0
+    #endif
     #if LV_USE_MEM_MONITOR
         #define LV_USE_MEM_MONITOR_POS LV_ALIGN_BOTTOM_LEFT
     #endif
 #endif /*LV_USE_SYSMON*/
 
-/** 1: Enable runtime performance profiler */
-#define LV_USE_PROFILER 0
+/** 1: Enable runtime performance profiler
+ *  - Enabled by the demo's DEMO_TRACE option (`--trace file.json`) */
+#ifdef DEMO_TRACE
+    #define LV_USE_PROFILER 1
+#else
+    #define LV_USE_PROFILER 0
+#endif
 #if LV_USE_PROFILER
     /** 1: Enable the built-in profiler */
     #define LV_USE_PROFILER_BUILTIN 1
     #if LV_USE_PROFILER_BUILTIN
         /** Default profiler trace buffer size */
-        #define LV_PROFILER_BUILTIN_BUF_SIZE (16 * 1024)     /**< [bytes] */
-        #define LV_PROFILER_BUILTIN_DEFAULT_ENABLE 1
+        #define LV_PROFILER_BUILTIN_BUF_SIZE (1024 * 1024)   /**< [bytes] */
+        #define LV_PROFILER_BUILTIN_DEFAULT_ENABLE 0          /**< Started by --trace */
         #define LV_USE_PROFILER_BUILTIN_POSIX 0 /**< Enable POSIX profiler port */
     #endif
 
@@ -1213,8 +1247,10 @@
  * DEVICES
  *==================*/
 
-/** Use SDL to open window on PC and handle mouse and keyboard. */
-#define LV_USE_SDL              1
+/** Use SDL to open window on PC and handle mouse and keyboard.
+ *  Off: the demo owns its SDL window and renders the device screen through
+ *  src/hal/SdlScreen (device resolution and color depth). */
+#define LV_USE_SDL              0
 #if LV_USE_SDL
     #define LV_SDL_INCLUDE_PATH     <SDL.h>
     #define LV_SDL_RENDER_MODE      LV_DISPLAY_RENDER_MODE_FULL   /**< FULL mode */
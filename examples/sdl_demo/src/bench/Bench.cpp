@@ -0,0 +1,887 @@
+#include "Bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "lvgl.h"
+
+#include "BenchAlloc.hpp"
+
+#include <oc/ui/lvgl/component/PageCache.hpp>
+#include <oc/ui/lvgl/component/ParameterBindings.hpp>
+#include <oc/ui/lvgl/component/ParameterEnum.hpp>
+#include <oc/ui/lvgl/component/ParameterKnob.hpp>
+#include <oc/ui/lvgl/component/ParameterPage.hpp>
+#include <oc/ui/lvgl/component/ParameterSwitch.hpp>
+#include <oc/ui/lvgl/theme/BaseTheme.hpp>
+#include <oc/ui/lvgl/widget/KnobBank.hpp>
+#include <oc/ui/lvgl/widget/Label.hpp>
+#include <oc/ui/lvgl/widget/VirtualList.hpp>
+
+using namespace oc::ui::lvgl;
+
+namespace {
+
+// ============================================================================
+// Virtual clock + offscreen display
+// ============================================================================
+
+constexpr uint32_t FRAME_MS = LV_DEF_REFR_PERIOD;  // Every frame is a refresh
+constexpr int WARMUP_FRAMES = 5;                   // Initial layout, not measured
+constexpr int BUF_LINES_DIV = 4;                   // Draw buffer = 1/4 screen (partial mode)
+
+uint32_t virtual_ms = 0;
+uint64_t frame_pixels = 0;
+uint64_t render_allocs = 0;       // Between REFR_START and REFR_READY
+uint64_t render_alloc_start = 0;
+
+uint32_t virtual_tick() {
+    return virtual_ms;
+}
+
+void count_flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    (void)px_map;
+    frame_pixels += lv_area_get_size(area);
+    lv_display_flush_ready(disp);
+}
+
+// Render window of a refresh: layout, drawing and flushing
+void render_window_cb(lv_event_t* e) {
+    if (lv_event_get_code(e) == LV_EVENT_REFR_START) {
+        render_alloc_start = BenchAlloc::count();
+    } else {
+        render_allocs += BenchAlloc::count() - render_alloc_start;
+    }
+}
+
+// Full-size transparent grid container (column/row descriptors owned by caller)
+lv_obj_t* make_grid(lv_obj_t* parent, std::vector<int32_t>& cols, std::vector<int32_t>& rows, int n_cols,
+                    int n_rows) {
+    cols.assign(n_cols, LV_GRID_FR(1));
+    cols.push_back(LV_GRID_TEMPLATE_LAST);
+    rows.assign(n_rows, LV_GRID_FR(1));
+    rows.push_back(LV_GRID_TEMPLATE_LAST);
+
+    lv_obj_t* grid = lv_obj_create(parent);
+    lv_obj_set_size(grid, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_opa(grid, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(grid, 0, 0);
+    lv_obj_set_style_pad_all(grid, 0, 0);
+    lv_obj_set_style_pad_gap(grid, 0, 0);
+    lv_obj_set_scrollbar_mode(grid, LV_SCROLLBAR_MODE_OFF);
+    lv_obj_set_grid_dsc_array(grid, cols.data(), rows.data());
+    lv_obj_set_layout(grid, LV_LAYOUT_GRID);
+    return grid;
+}
+
+void place(lv_obj_t* obj, int col, int row) {
+    lv_obj_set_grid_cell(obj, LV_GRID_ALIGN_STRETCH, col, 1, LV_GRID_ALIGN_STRETCH, row, 1);
+}
+
+// Objects below obj (not counting obj itself)
+uint32_t count_objects(const lv_obj_t* obj) {
+    uint32_t count = 0;
+    uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; i++) {
+        count += 1 + count_objects(lv_obj_get_child(obj, static_cast<int32_t>(i)));
+    }
+    return count;
+}
+
+// Deterministic 0..1 triangle wave
+float triangle(float phase) {
+    float t = phase - std::floor(phase);
+    return t < 0.5f ? t * 2.0f : 2.0f - t * 2.0f;
+}
+
+// ============================================================================
+// Scenarios
+// ============================================================================
+
+struct Metric {
+    std::string scenario;
+    std::string name;
+    double value;
+};
+
+class Scenario {
+public:
+    virtual ~Scenario() = default;
+    virtual const char* name() const = 0;
+    virtual int32_t width() const { return 320; }
+    virtual int32_t height() const { return 240; }
+    virtual double budgetUs() const { return 0.0; }  // p99 limit, 0 = none
+    virtual double pxLimit() const { return 0.0; }   // px_per_frame limit, 0 = none
+    virtual bool countStepAllocs() const { return false; }  // step_allocs, 0 required with OC_UI_LVGL_STATIC_ALLOC
+    virtual void setup(lv_obj_t* screen) = 0;
+    virtual void step(int frame) = 0;
+    virtual void addMetrics(const char* name, std::vector<Metric>& out) const {  // Scenario-specific results
+        (void)name;
+        (void)out;
+    }
+};
+
+// One 64 px knob stepped by one encoder detent (1/100) per frame: a step
+// redraws the swept band and the old/new indicator, well under half the knob
+// (a whole-knob invalidation flushes 64 x 64 = 4096 px)
+class KnobDetent : public Scenario {
+public:
+    static constexpr int32_t SIZE = 64;
+    static constexpr int DETENTS = 100;
+
+    const char* name() const override { return "knob_detent"; }
+    double pxLimit() const override { return SIZE * SIZE / 2.0; }
+
+    void setup(lv_obj_t* screen) override {
+        knob_ = std::make_unique<KnobWidget>(screen);
+        knob_->trackColor(base_theme::color::getMacroColor(0));
+        lv_obj_set_size(knob_->getElement(), SIZE, SIZE);
+        lv_obj_center(knob_->getElement());
+    }
+
+    void step(int frame) override {
+        int pos = frame % (2 * DETENTS);  // Up then down, one detent per frame
+        int detent = pos <= DETENTS ? pos : 2 * DETENTS - pos;
+        knob_->setValue(static_cast<float>(detent) / DETENTS);
+    }
+
+private:
+    std::unique_ptr<KnobWidget> knob_;
+};
+
+// 8 encoders sweeping a 4x2 ParameterKnob page at different speeds
+class EncoderSweep : public Scenario {
+public:
+    const char* name() const override { return "encoder_sweep"; }
+
+    void setup(lv_obj_t* screen) override {
+        lv_obj_t* grid = make_grid(screen, cols_, rows_, 4, 2);
+        for (int i = 0; i < 8; i++) {
+            auto knob = std::make_unique<ParameterKnob>(grid);
+            knob->knob().trackColor(base_theme::color::getMacroColor(i));
+            knob->label().setText("Macro");
+            place(knob->getElement(), i % 4, i / 4);
+            knobs_.push_back(std::move(knob));
+        }
+    }
+
+    void step(int frame) override {
+        for (size_t i = 0; i < knobs_.size(); i++) {
+            float speed = 0.004f * static_cast<float>(i + 1);
+            knobs_[i]->knob().setValue(triangle(frame * speed + 0.125f * i));
+        }
+    }
+
+private:
+    std::vector<int32_t> cols_, rows_;
+    std::vector<std::unique_ptr<ParameterKnob>> knobs_;
+};
+
+// 64 knobs (8x8) at 800x480, all moving every frame
+class Knobs64 : public Scenario {
+public:
+    const char* name() const override { return "knobs_64"; }
+    int32_t width() const override { return 800; }
+    int32_t height() const override { return 480; }
+
+    void setup(lv_obj_t* screen) override {
+        lv_obj_t* grid = make_grid(screen, cols_, rows_, 8, 8);
+        for (int i = 0; i < 64; i++) {
+            auto knob = std::make_unique<KnobWidget>(grid);
+            knob->trackColor(base_theme::color::getMacroColor(i % 8));
+            place(knob->getElement(), i % 8, i / 8);
+            knobs_.push_back(std::move(knob));
+        }
+    }
+
+    void step(int frame) override {
+        for (size_t i = 0; i < knobs_.size(); i++) {
+            knobs_[i]->setValue(triangle(frame * 0.01f + 0.015625f * i));
+        }
+    }
+
+private:
+    std::vector<int32_t> cols_, rows_;
+    std::vector<std::unique_ptr<KnobWidget>> knobs_;
+};
+
+// Same 64 knobs and motion as knobs_64, driven through a KnobBank
+class Knobs64Bank : public Scenario {
+public:
+    const char* name() const override { return "knobs_64_bank"; }
+    int32_t width() const override { return 800; }
+    int32_t height() const override { return 480; }
+
+    void setup(lv_obj_t* screen) override {
+        lv_obj_t* grid = make_grid(screen, cols_, rows_, 8, 8);
+        bank_.reserve(64);
+        for (int i = 0; i < 64; i++) {
+            KnobWidget& knob = bank_.add(grid);
+            knob.trackColor(base_theme::color::getMacroColor(i % 8));
+            place(knob.getElement(), i % 8, i / 8);
+        }
+    }
+
+    void step(int frame) override {
+        for (size_t i = 0; i < bank_.size(); i++) {
+            values_[i] = triangle(frame * 0.01f + 0.015625f * i);
+        }
+        bank_.setValues(values_, bank_.size());
+        bank_.commit();
+    }
+
+private:
+    std::vector<int32_t> cols_, rows_;
+    KnobBank bank_;
+    float values_[64] = {};
+};
+
+// 192 small knobs (16x12 at 576x432, 36 px), all moving, one LOD level forced
+class KnobsLod : public Scenario {
+public:
+    explicit KnobsLod(KnobLod level) : level_(level) {}
+
+    const char* name() const override {
+        static const char* const NAMES[] = {"knobs_lod_full", "knobs_lod_no_inner", "knobs_lod_no_indicator",
+                                            "knobs_lod_square_caps"};
+        return NAMES[static_cast<int>(level_)];
+    }
+    int32_t width() const override { return 576; }
+    int32_t height() const override { return 432; }
+
+    void setup(lv_obj_t* screen) override {
+        constexpr lv_coord_t ALWAYS = 1024;  // Above any knob size
+        auto below = [this](KnobLod level) { return level_ >= level ? ALWAYS : lv_coord_t(0); };
+
+        lv_obj_t* grid = make_grid(screen, cols_, rows_, 16, 12);
+        for (int i = 0; i < 192; i++) {
+            auto knob = std::make_unique<KnobWidget>(grid);
+            knob->trackColor(base_theme::color::getMacroColor(i % 8))
+                .lodThresholds(below(KnobLod::NoInnerCircle), below(KnobLod::NoIndicator),
+                               below(KnobLod::SquareCaps));
+            place(knob->getElement(), i % 16, i / 16);
+            knobs_.push_back(std::move(knob));
+        }
+    }
+
+    void step(int frame) override {
+        for (size_t i = 0; i < knobs_.size(); i++) {
+            knobs_[i]->setValue(triangle(frame * 0.01f + 0.0052f * i));
+        }
+    }
+
+private:
+    KnobLod level_;
+    std::vector<int32_t> cols_, rows_;
+    std::vector<std::unique_ptr<KnobWidget>> knobs_;
+};
+
+// VirtualList spinning through 50k items (every frame lands on a new page)
+class ListSpin : public Scenario {
+public:
+    static constexpr int ITEM_COUNT = 50000;
+    static constexpr int STRIDE = 167;  // ~300 frames cover the list
+
+    const char* name() const override { return "list_50k"; }
+
+    void setup(lv_obj_t* screen) override {
+        list_ = std::make_unique<widget::VirtualList>(screen);
+        list_->size(LV_PCT(100), 240).visibleCount(8).onBindSlot(
+            [](widget::VirtualSlot& slot, int index, bool selected) {
+                auto* label = static_cast<lv_obj_t*>(slot.userData);
+                if (!label) {
+                    label = lv_label_create(slot.container);
+                    lv_obj_center(label);
+                    slot.userData = label;
+                }
+                lv_label_set_text_fmt(label, "Item %d", index);
+                lv_obj_set_style_text_color(
+                    label, lv_color_hex(selected ? base_theme::color::ACTIVE : base_theme::color::TEXT_PRIMARY), 0);
+            });
+        list_->setTotalCount(ITEM_COUNT);
+        list_->show();
+    }
+
+    void step(int frame) override { list_->setSelectedIndex((frame * STRIDE) % ITEM_COUNT); }
+
+private:
+    std::unique_ptr<widget::VirtualList> list_;
+};
+
+// 20 overflowing labels scrolling (animations driven by the virtual clock)
+class Marquee20 : public Scenario {
+public:
+    const char* name() const override { return "marquee_20"; }
+
+    void setup(lv_obj_t* screen) override {
+        lv_obj_t* grid = make_grid(screen, cols_, rows_, 2, 10);
+        char text[64];
+        for (int i = 0; i < 20; i++) {
+            auto label = std::make_unique<Label>(grid);
+            label->autoScroll(true).color(base_theme::color::TEXT_PRIMARY);
+            lv_snprintf(text, sizeof(text), "Marquee %02d - text much wider than its cell", i);
+            label->setText(text);
+            place(label->getElement(), i % 2, i / 2);
+            labels_.push_back(std::move(label));
+        }
+    }
+
+    void step(int frame) override { (void)frame; }
+
+private:
+    std::vector<int32_t> cols_, rows_;
+    std::vector<std::unique_ptr<Label>> labels_;
+};
+
+// 8 ParameterEnums cycling values with flashes
+class EnumCycle : public Scenario {
+public:
+    const char* name() const override { return "enum_cycle"; }
+
+    void setup(lv_obj_t* screen) override {
+        lv_obj_t* grid = make_grid(screen, cols_, rows_, 4, 2);
+        for (int i = 0; i < 8; i++) {
+            auto param = std::make_unique<ParameterEnum>(grid);
+            param->enumWidget().lineColor(base_theme::color::getMacroColor(i));
+            param->valueLabel().alignment(LV_TEXT_ALIGN_CENTER).setText(VALUES[0]);
+            param->nameLabel().alignment(LV_TEXT_ALIGN_CENTER).setText("Wave");
+            place(param->getElement(), i % 4, i / 4);
+            params_.push_back(std::move(param));
+        }
+    }
+
+    void step(int frame) override {
+        for (size_t i = 0; i < params_.size(); i++) {
+            if ((frame + static_cast<int>(i)) % 3 != 0) continue;
+            params_[i]->valueLabel().setText(VALUES[(frame / 3 + i) % 5]);
+            params_[i]->enumWidget().triggerFlash();
+        }
+    }
+
+private:
+    static constexpr const char* VALUES[] = {"Sine", "Triangle", "Sawtooth", "Square", "Noise"};
+    std::vector<int32_t> cols_, rows_;
+    std::vector<std::unique_ptr<ParameterEnum>> params_;
+};
+
+// 4096 parameters changing 2000 times per frame, 8 of them bound to a knob
+// page: cost should follow the bound changes, not the traffic
+class Bindings4k : public Scenario {
+public:
+    static constexpr uint32_t PARAM_COUNT = 4096;
+    static constexpr int CHANGES_PER_FRAME = 2000;
+
+    const char* name() const override { return "bindings_4k"; }
+
+    void setup(lv_obj_t* screen) override {
+        lv_obj_t* grid = make_grid(screen, cols_, rows_, 4, 2);
+        for (int i = 0; i < 8; i++) {
+            auto knob = std::make_unique<ParameterKnob>(grid);
+            knob->knob().trackColor(base_theme::color::getMacroColor(i));
+            knob->label().setText("Param");
+            place(knob->getElement(), i % 4, i / 4);
+            bindings_.bind(boundId(i), *knob);
+            knobs_.push_back(std::move(knob));
+        }
+        bindings_.attach();
+    }
+
+    void step(int frame) override {
+        for (int n = 0; n < CHANGES_PER_FRAME; n++) {
+            rng_ = rng_ * 1664525u + 1013904223u;  // LCG: deterministic traffic
+            bindings_.setValue((rng_ >> 8) % PARAM_COUNT, static_cast<float>(rng_ & 0xFF) / 255.0f);
+        }
+        for (int i = 0; i < 8; i++) {
+            bindings_.setValue(boundId(i), triangle(frame * 0.004f * (i + 1) + 0.125f * i));
+        }
+    }
+
+private:
+    static uint32_t boundId(int i) { return static_cast<uint32_t>(i) * (PARAM_COUNT / 8); }
+
+    ParameterBindings bindings_{PARAM_COUNT};  // Detaches after the knobs are gone
+    std::vector<int32_t> cols_, rows_;
+    std::vector<std::unique_ptr<ParameterKnob>> knobs_;
+    uint32_t rng_ = 1;
+};
+
+// ParameterPage switching bank every frame (frame time = switch + redraw,
+// must stay under one LV_DEF_REFR_PERIOD)
+class PageSwitch : public Scenario {
+public:
+    explicit PageSwitch(ObjectTree tree = ObjectTree::Standard) : tree_(tree) {}
+
+    const char* name() const override { return tree_ == ObjectTree::Lean ? "page_switch_lean" : "page_switch"; }
+
+    void setup(lv_obj_t* screen) override {
+        page_ = std::make_unique<ParameterPage>(screen, 4, 2, tree_);
+        page_->setPage(PAGES[0], 8);
+    }
+
+    double budgetUs() const override { return FRAME_MS * 1000.0; }
+
+    void step(int frame) override { page_->setPage(PAGES[frame % 3], 8); }
+
+protected:
+    using K = ParameterType;
+    static constexpr ParameterSlot PAGES[3][8] = {
+        {{K::Knob, "Cutoff", 0xFCEB23, false, 0.42f, ""}, {K::Knob, "Reso", 0, false, 0.1f, ""},
+         {K::Knob, "Drive", 0, false, 0.0f, ""}, {K::Knob, "Pan", 0, true, 0.5f, ""},
+         {K::Enum, "Wave", 0, false, 0.0f, "Saw"}, {K::Switch, "Bypass", 0, false, 0.0f, "OFF"},
+         {K::Knob, "Attack", 0, false, 0.05f, ""}, {K::Knob, "Release", 0, false, 0.6f, ""}},
+        {{K::Knob, "Rate", 0xECA747, false, 0.3f, ""}, {K::Knob, "Depth", 0, false, 0.8f, ""},
+         {K::Enum, "Shape", 0, false, 0.0f, "Sine"}, {K::Knob, "Offset", 0, true, 0.25f, ""},
+         {K::Knob, "Mix", 0, false, 1.0f, ""}, {K::Switch, "Sync", 0, false, 1.0f, "ON"},
+         {K::None}, {K::Knob, "Phase", 0, false, 0.5f, ""}},
+        {{K::Switch, "Mute", 0, false, 0.0f, "OFF"}, {K::Switch, "Solo", 0, false, 1.0f, "ON"},
+         {K::Knob, "Volume", 0, false, 0.75f, ""}, {K::Knob, "Pan", 0, true, 0.5f, ""},
+         {K::Knob, "Send A", 0, false, 0.2f, ""}, {K::Knob, "Send B", 0, false, 0.0f, ""},
+         {K::Enum, "Input", 0, false, 0.0f, "Ext 1"}, {K::Enum, "Output", 0, false, 0.0f, "Master"}},
+    };
+
+    ObjectTree tree_;
+    std::unique_ptr<ParameterPage> page_;
+};
+
+// One mixed page resized every frame: full layout of every component
+// (grid tracks, labels, square policies), standard vs lean object trees
+class PageRelayout : public PageSwitch {
+public:
+    explicit PageRelayout(ObjectTree tree) : PageSwitch(tree) {}
+
+    const char* name() const override {
+        return tree_ == ObjectTree::Lean ? "page_relayout_lean" : "page_relayout";
+    }
+    double budgetUs() const override { return 0.0; }
+
+    void setup(lv_obj_t* screen) override {
+        PageSwitch::setup(screen);
+        page_->setPage(PAGES[2], 8);  // Every component type
+    }
+
+    void step(int frame) override {
+        lv_obj_set_width(page_->getElement(), frame % 2 ? LV_PCT(100) : LV_PCT(90));
+    }
+};
+
+// ParameterPage as a PageCache page
+class CachedPage : public IComponent {
+public:
+    CachedPage(lv_obj_t* parent, const ParameterSlot* slots) : page_(parent, 4, 2, ObjectTree::Lean) {
+        page_.setPage(slots, 8);
+    }
+
+    lv_obj_t* getElement() const override { return page_.getElement(); }
+    void show() override { lv_obj_remove_flag(getElement(), LV_OBJ_FLAG_HIDDEN); }
+    void hide() override { lv_obj_add_flag(getElement(), LV_OBJ_FLAG_HIDDEN); }
+    bool isVisible() const override { return !lv_obj_has_flag(getElement(), LV_OBJ_FLAG_HIDDEN); }
+
+private:
+    ParameterPage page_;
+};
+
+// Six pages through a PageCache that holds about three: even frames return
+// to the home page (hit), odd frames rotate through the other five (miss,
+// rebuilt after their eviction). The budget is in objects (the memory probe
+// counts them), so it doesn't depend on the allocator behind LVGL.
+class PageCacheCycle : public PageSwitch {
+public:
+    PageCacheCycle() : PageSwitch(ObjectTree::Lean) {}
+
+    const char* name() const override { return "page_cache"; }
+    double budgetUs() const override { return 0.0; }
+
+    void setup(lv_obj_t* screen) override {
+        root_ = screen;
+        cache_ = std::make_unique<PageCache>(screen, 0);
+        cache_->setMemoryProbe(objectCount);
+        cache_->setClock(micros);
+        for (PageCache::PageId id = 0; id < PAGE_COUNT; id++) {
+            cache_->add(id, [id](lv_obj_t* parent, const PageCache::Snapshot& state) {
+                (void)state;
+                return std::make_unique<CachedPage>(parent, PAGES[id % 3]);
+            });
+        }
+        cache_->setBudget(SIZE_MAX);
+        cache_->show(0);
+        size_t per_page = objectCount();
+        cache_->setBudget(per_page * 3 + per_page / 2);
+    }
+
+    void step(int frame) override {
+        if (frame == WARMUP_FRAMES) base_ = cache_->stats();
+        cache_->show(frame % 2 ? static_cast<PageCache::PageId>(1 + (frame / 2) % (PAGE_COUNT - 1)) : 0);
+    }
+
+    void addMetrics(const char* name, std::vector<Metric>& out) const override {
+        const PageCache::Stats& stats = cache_->stats();
+        uint32_t misses = stats.misses - base_.misses;
+        out.push_back({name, "page_hits", static_cast<double>(stats.hits - base_.hits)});
+        out.push_back({name, "page_misses", static_cast<double>(misses)});
+        out.push_back({name, "page_rebuilds", static_cast<double>(stats.rebuilds - base_.rebuilds)});
+        out.push_back({name, "page_evictions", static_cast<double>(stats.evictions - base_.evictions)});
+        out.push_back({name, "build_avg_us",
+                       misses ? static_cast<double>(stats.total_build_us - base_.total_build_us) / misses : 0.0});
+        out.push_back({name, "build_max_us", static_cast<double>(stats.max_build_us)});
+    }
+
+private:
+    static constexpr PageCache::PageId PAGE_COUNT = 6;
+
+    static size_t objectCount() { return root_ ? count_objects(root_) : 0; }
+    static uint32_t micros() {
+        auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(now).count());
+    }
+
+    static inline lv_obj_t* root_ = nullptr;
+    std::unique_ptr<PageCache> cache_;
+    PageCache::Stats base_;
+};
+
+// Steady-state updates of every widget type (values, flashes, text, list
+// navigation). Allocations of whole frames after warm-up are reported as
+// step_allocs: step() plus every timer and animation of lv_timer_handler()
+// (flashes, label scrolling, measure timers), without LVGL's
+// render window (REFR_START to REFR_READY). In OC_UI_LVGL_STATIC_ALLOC builds
+// any such allocation fails the run.
+class AllocFree : public Scenario {
+public:
+    ~AllocFree() override { slot_labels_.clear(); }  // Before the list deletes their parents
+
+    const char* name() const override { return "alloc_free"; }
+    bool countStepAllocs() const override { return true; }
+
+    void setup(lv_obj_t* screen) override {
+        lv_obj_t* grid = make_grid(screen, cols_, rows_, 4, 2);
+        for (int i = 0; i < 4; i++) {
+            auto knob = std::make_unique<ParameterKnob>(grid);
+            knob->label().setText("Macro");
+            place(knob->getElement(), i, 0);
+            knobs_.push_back(std::move(knob));
+        }
+        enum_ = std::make_unique<ParameterEnum>(grid);
+        enum_->valueLabel().setText(VALUES[0]);
+        enum_->nameLabel().setText("Wave");
+        place(enum_->getElement(), 0, 1);
+
+        switch_ = std::make_unique<ParameterSwitch>(grid);
+        switch_->button().setText("OFF");
+        switch_->label().setText("Bypass");
+        place(switch_->getElement(), 1, 1);
+
+        // Captureless callback: convertible to the static mode's function pointer
+        list_ = std::make_unique<widget::VirtualList>(grid);
+        list_->visibleCount(4).onBindSlot([](widget::VirtualSlot& slot, int index, bool selected) {
+            auto* label = static_cast<Label*>(slot.userData);
+            if (!label) {
+                slot_labels_.push_back(std::make_unique<Label>(slot.container));
+                label = slot_labels_.back().get();
+                slot.userData = label;
+            }
+            label->color(selected ? base_theme::color::ACTIVE : base_theme::color::TEXT_PRIMARY);
+            label->setText(index, "Item ");
+        });
+        lv_obj_set_grid_cell(list_->getElement(), LV_GRID_ALIGN_STRETCH, 2, 2, LV_GRID_ALIGN_STRETCH, 1, 1);
+        list_->setTotalCount(1000);
+        list_->show();
+    }
+
+    void step(int frame) override {
+        for (size_t i = 0; i < knobs_.size(); i++) {
+            knobs_[i]->knob().setValue(triangle(frame * 0.02f + 0.25f * i));
+        }
+        if (frame % 3 == 0) {
+            enum_->valueLabel().setText(VALUES[(frame / 3) % 5]);
+            enum_->enumWidget().triggerFlash();
+        }
+        if (frame % 5 == 0) {
+            bool on = (frame / 5) % 2 != 0;
+            switch_->button().setState(on);
+            switch_->button().setText(on ? "ON" : "OFF");
+        }
+        list_->setSelectedIndex(frame % 1000);
+    }
+
+private:
+    static constexpr const char* VALUES[] = {"Sine", "Triangle", "Sawtooth", "Square", "Noise"};
+    static inline std::vector<std::unique_ptr<Label>> slot_labels_;
+
+    std::vector<int32_t> cols_, rows_;
+    std::vector<std::unique_ptr<ParameterKnob>> knobs_;
+    std::unique_ptr<ParameterEnum> enum_;
+    std::unique_ptr<ParameterSwitch> switch_;
+    std::unique_ptr<widget::VirtualList> list_;
+};
+
+std::vector<std::unique_ptr<Scenario>> make_scenarios() {
+    std::vector<std::unique_ptr<Scenario>> all;
+    all.push_back(std::make_unique<KnobDetent>());
+    all.push_back(std::make_unique<EncoderSweep>());
+    all.push_back(std::make_unique<Knobs64>());
+    all.push_back(std::make_unique<Knobs64Bank>());
+    for (KnobLod level : {KnobLod::Full, KnobLod::NoInnerCircle, KnobLod::NoIndicator, KnobLod::SquareCaps}) {
+        all.push_back(std::make_unique<KnobsLod>(level));
+    }
+    all.push_back(std::make_unique<ListSpin>());
+    all.push_back(std::make_unique<Marquee20>());
+    all.push_back(std::make_unique<EnumCycle>());
+    all.push_back(std::make_unique<Bindings4k>());
+    all.push_back(std::make_unique<PageSwitch>());
+    all.push_back(std::make_unique<PageSwitch>(ObjectTree::Lean));
+    all.push_back(std::make_unique<PageRelayout>(ObjectTree::Standard));
+    all.push_back(std::make_unique<PageRelayout>(ObjectTree::Lean));
+    all.push_back(std::make_unique<PageCacheCycle>());
+    all.push_back(std::make_unique<AllocFree>());
+    return all;
+}
+
+// ============================================================================
+// Measurement
+// ============================================================================
+
+double percentile(std::vector<double> sorted, int pct) {
+    if (sorted.empty()) return 0.0;
+    size_t idx = std::min(sorted.size() - 1, sorted.size() * pct / 100);
+    return sorted[idx];
+}
+
+// Returns false if the scenario exceeds its p99 budget, pixel limit or allocates when it must not
+bool run_scenario(std::unique_ptr<Scenario> scenario, int frames, std::vector<Metric>& out) {
+    int32_t w = scenario->width();
+    int32_t h = scenario->height();
+
+    lv_display_t* disp = lv_display_create(w, h);
+    uint32_t px_size = lv_color_format_get_size(lv_display_get_color_format(disp));
+    std::vector<uint8_t> buf(static_cast<size_t>(w) * h / BUF_LINES_DIV * px_size);
+    lv_display_set_buffers(disp, buf.data(), nullptr, static_cast<uint32_t>(buf.size()),
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, count_flush_cb);
+    lv_display_add_event_cb(disp, render_window_cb, LV_EVENT_REFR_START, nullptr);
+    lv_display_add_event_cb(disp, render_window_cb, LV_EVENT_REFR_READY, nullptr);
+    lv_display_set_default(disp);
+
+    lv_obj_t* screen = lv_display_get_screen_active(disp);
+    lv_obj_set_style_bg_color(screen, lv_color_hex(base_theme::color::BACKGROUND), 0);
+    lv_obj_set_style_pad_all(screen, 0, 0);
+    scenario->setup(screen);
+
+    std::vector<double> times_us;
+    std::vector<double> pixels;
+    std::vector<double> allocs;
+    std::vector<double> render_allocs_per_frame;
+    uint64_t step_allocs = 0;
+    times_us.reserve(frames);
+    pixels.reserve(frames);
+    allocs.reserve(frames);
+    render_allocs_per_frame.reserve(frames);
+
+    for (int frame = 0; frame < frames + WARMUP_FRAMES; frame++) {
+        virtual_ms += FRAME_MS;
+        frame_pixels = 0;
+        render_allocs = 0;
+        uint64_t alloc_start = BenchAlloc::count();
+        auto start = std::chrono::steady_clock::now();
+
+        scenario->step(frame);
+        lv_timer_handler();
+
+        auto end = std::chrono::steady_clock::now();
+        uint64_t alloc_count = BenchAlloc::count() - alloc_start;
+        if (frame < WARMUP_FRAMES) continue;
+
+        uint64_t outside_render = alloc_count - render_allocs;  // Whole frame outside rendering
+        step_allocs += outside_render;
+
+        times_us.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        pixels.push_back(static_cast<double>(frame_pixels));
+        allocs.push_back(static_cast<double>(outside_render));
+        render_allocs_per_frame.push_back(static_cast<double>(render_allocs));
+    }
+
+    uint32_t objects = count_objects(screen);  // Including pools grown while running
+    std::sort(times_us.begin(), times_us.end());
+    double px_mean = 0.0, alloc_mean = 0.0, render_alloc_mean = 0.0;
+    for (double p : pixels) px_mean += p;
+    for (double a : allocs) alloc_mean += a;
+    for (double a : render_allocs_per_frame) render_alloc_mean += a;
+    px_mean /= std::max<size_t>(1, pixels.size());
+    alloc_mean /= std::max<size_t>(1, allocs.size());
+    render_alloc_mean /= std::max<size_t>(1, render_allocs_per_frame.size());
+
+    const char* n = scenario->name();
+    double p99 = percentile(times_us, 99);
+    out.push_back({n, "p50_us", percentile(times_us, 50)});
+    out.push_back({n, "p95_us", percentile(times_us, 95)});
+    out.push_back({n, "p99_us", p99});
+    out.push_back({n, "px_per_frame", px_mean});
+    out.push_back({n, "objects", static_cast<double>(objects)});
+    if (BenchAlloc::available()) {
+        // Widgets, timers and animations; LVGL's rendering separately
+        out.push_back({n, "allocs_per_frame", alloc_mean});
+        out.push_back({n, "render_allocs", render_alloc_mean});
+    }
+
+    bool within_budget = scenario->budgetUs() <= 0.0 || p99 <= scenario->budgetUs();
+    if (!within_budget) {
+        std::printf("Bench: %s p99 %.0f us over its %.0f us budget\n", n, p99, scenario->budgetUs());
+    }
+
+    bool within_px = scenario->pxLimit() <= 0.0 || px_mean <= scenario->pxLimit();
+    if (!within_px) {
+        std::printf("Bench: %s flushes %.0f px per frame, over its %.0f px limit\n", n, px_mean,
+                    scenario->pxLimit());
+    }
+
+    bool alloc_free = true;
+    if (BenchAlloc::available() && scenario->countStepAllocs()) {
+        out.push_back({n, "step_allocs", static_cast<double>(step_allocs)});
+        if (OC_UI_LVGL_STATIC_ALLOC && step_allocs > 0) {
+            std::printf("Bench: %s allocated %llu times outside rendering\n", n,
+                        static_cast<unsigned long long>(step_allocs));
+            alloc_free = false;
+        }
+    }
+
+    scenario->addMetrics(n, out);
+
+    // Widgets first (they delete their LVGL objects), then the display
+    scenario.reset();
+    lv_display_delete(disp);
+    return within_budget && within_px && alloc_free;
+}
+
+// ============================================================================
+// Baselines
+// ============================================================================
+
+struct Baseline {
+    std::string scenario;
+    std::string metric;
+    double value;
+    double tolerance_pct;
+};
+
+std::vector<Baseline> load_baselines(const char* path, bool& ok) {
+    std::vector<Baseline> baselines;
+    FILE* f = std::fopen(path, "r");
+    ok = f != nullptr;
+    if (!f) return baselines;
+
+    char line[256];
+    while (std::fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        char scenario[64], metric[64];
+        double value = 0.0, tolerance = 0.0;
+        if (std::sscanf(line, "%63s %63s %lf %lf", scenario, metric, &value, &tolerance) == 4) {
+            baselines.push_back({scenario, metric, value, tolerance});
+        }
+    }
+    std::fclose(f);
+    return baselines;
+}
+
+// Default tolerances when writing baselines: wall-clock timing is noisy,
+// pixel and allocation counts are deterministic
+double default_tolerance(const std::string& metric) {
+    if (metric.size() > 3 && metric.compare(metric.size() - 3, 3, "_us") == 0) return 25.0;
+    if (metric == "allocs_per_frame" || metric == "render_allocs") return 10.0;
+    return 5.0;
+}
+
+bool write_baselines(const char* path, const std::vector<Metric>& metrics) {
+    FILE* f = std::fopen(path, "w");
+    if (!f) return false;
+    std::fprintf(f, "# Widget benchmark baselines (demo --bench)\n");
+    std::fprintf(f, "# scenario metric value tolerance_pct\n");
+    for (const auto& m : metrics) {
+        std::fprintf(f, "%s %s %.1f %.0f\n", m.scenario.c_str(), m.name.c_str(), m.value,
+                     default_tolerance(m.name));
+    }
+    std::fclose(f);
+    return true;
+}
+
+}  // namespace
+
+namespace Bench {
+
+int run(const Options& options) {
+    lv_tick_set_cb(virtual_tick);
+    std::printf("Bench: %d SW draw unit(s)%s\n", LV_DRAW_SW_DRAW_UNIT_CNT,
+                LV_USE_OS != LV_OS_NONE ? ", threaded" : "");
+
+    int rc = 0;
+    std::vector<Metric> metrics;
+    auto scenarios = make_scenarios();
+    for (auto& scenario : scenarios) {
+        if (options.filter && !std::strstr(scenario->name(), options.filter)) continue;
+        std::printf("Bench: %s (%dx%d, %d frames)\n", scenario->name(), static_cast<int>(scenario->width()),
+                    static_cast<int>(scenario->height()), options.frames);
+        if (!run_scenario(std::move(scenario), options.frames, metrics)) rc = 1;
+    }
+
+    std::vector<Baseline> baselines;
+    for (const char* path : options.baselines) {
+        bool ok = false;
+        std::vector<Baseline> loaded = load_baselines(path, ok);
+        if (!ok) {
+            std::printf("Bench: cannot read baselines %s\n", path);
+            rc = 1;
+        }
+        baselines.insert(baselines.end(), loaded.begin(), loaded.end());
+    }
+
+    std::printf("\n%-14s %-17s %12s %12s %8s  %s\n", "scenario", "metric", "value", "baseline", "delta", "status");
+    for (const auto& m : metrics) {
+        // Later files override earlier ones
+        auto it = std::find_if(baselines.rbegin(), baselines.rend(), [&](const Baseline& b) {
+            return b.scenario == m.scenario && b.metric == m.name;
+        });
+        if (it == baselines.rend()) {
+            std::printf("%-14s %-17s %12.1f %12s %8s  %s\n", m.scenario.c_str(), m.name.c_str(), m.value, "-",
+                        "-", options.baselines.empty() ? "" : "no baseline");
+            continue;
+        }
+        // All metrics are lower-is-better. A zero baseline is an absolute
+        // limit (no allocations): any increase fails, whatever the tolerance.
+        const char* status = "ok";
+        if (it->value <= 0.0) {
+            if (m.value > 0.0) {
+                status = "REGRESSION";
+                rc = 1;
+            }
+            std::printf("%-14s %-17s %12.1f %12.1f %8s  %s\n", m.scenario.c_str(), m.name.c_str(), m.value,
+                        it->value, "limit", status);
+            continue;
+        }
+        double delta_pct = (m.value - it->value) * 100.0 / it->value;
+        if (delta_pct > it->tolerance_pct) {
+            status = "REGRESSION";
+            rc = 1;
+        } else if (delta_pct < -it->tolerance_pct) {
+            status = "improved (update baseline)";
+        }
+        std::printf("%-14s %-17s %12.1f %12.1f %+7.1f%%  %s\n", m.scenario.c_str(), m.name.c_str(), m.value,
+                    it->value, delta_pct, status);
+    }
+
+    if (options.update) {
+        if (write_baselines(options.update, metrics)) {
+            std::printf("\nBench: baselines written to %s\n", options.update);
+        } else {
+            std::printf("\nBench: cannot write %s\n", options.update);
+            rc = 1;
+        }
+    }
+    return rc;
+}
+
+}  // namespace Bench
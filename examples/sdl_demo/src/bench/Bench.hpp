@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+
+// ============================================================================
+// Headless frame-time benchmark (--bench)
+//
+// Runs deterministic widget scenarios on an offscreen LVGL display driven by
+// a virtual clock (one LV_DEF_REFR_PERIOD step per frame), so every frame
+// renders and animations advance identically on every machine. Per scenario:
+// frame-time percentiles (wall clock), pixels flushed per frame and
+// allocations per frame outside / inside rendering (DEMO_BENCH builds only).
+//
+// Results can be compared against baselines files
+// (`scenario metric value tolerance_pct` per line; a 0 baseline is an
+// absolute limit) or written as new baselines. Call after lv_init(),
+// without the SDL display.
+// ============================================================================
+namespace Bench {
+
+struct Options {
+    std::vector<const char*> baselines;  // Compare results against these files (later rows win)
+    const char* update = nullptr;        // Write results to this file as new baselines
+    const char* filter = nullptr;        // Only scenarios whose name contains this
+    int frames = 300;                    // Measured frames per scenario
+};
+
+// Returns the process exit code: 0 = ok, 1 = regression or error
+int run(const Options& options);
+
+}  // namespace Bench
@@ -0,0 +1,188 @@
+#include "BenchAlloc.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "lvgl.h"
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+
+#ifndef DEMO_BENCH_WRAP_MALLOC
+#define DEMO_BENCH_WRAP_MALLOC 0
+#endif
+
+namespace {
+
+std::atomic<uint64_t> alloc_count{0};
+std::atomic<size_t> lv_used_bytes{0};
+std::atomic<size_t> lv_max_used_bytes{0};
+std::atomic<uint32_t> lv_used_blocks{0};
+
+// Each LVGL block is prefixed with its size (kept max-aligned)
+constexpr size_t HEADER = alignof(std::max_align_t) > sizeof(size_t) ? alignof(std::max_align_t) : sizeof(size_t);
+
+// LVGL and operator new sit on top of malloc: when it is wrapped, they
+// must not count the same allocation a second time
+void count_alloc() {
+    if (!DEMO_BENCH_WRAP_MALLOC) alloc_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void track_lv(ptrdiff_t delta_bytes, int delta_blocks) {
+    size_t used = lv_used_bytes.fetch_add(static_cast<size_t>(delta_bytes)) + static_cast<size_t>(delta_bytes);
+    lv_used_blocks.fetch_add(static_cast<uint32_t>(delta_blocks));
+    size_t max = lv_max_used_bytes.load();
+    while (used > max && !lv_max_used_bytes.compare_exchange_weak(max, used)) {}
+}
+
+}  // namespace
+
+namespace BenchAlloc {
+
+bool available() {
+    return true;
+}
+
+uint64_t count() {
+    return alloc_count.load(std::memory_order_relaxed);
+}
+
+}  // namespace BenchAlloc
+
+// ----------------------------------------------------------------------------
+// LV_STDLIB_CUSTOM hooks
+// ----------------------------------------------------------------------------
+extern "C" {
+
+void lv_mem_init(void) {}
+
+void lv_mem_deinit(void) {}
+
+lv_mem_pool_t lv_mem_add_pool(void* mem, size_t bytes) {
+    (void)mem;
+    (void)bytes;
+    return nullptr;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool) {
+    (void)pool;
+}
+
+void* lv_malloc_core(size_t size) {
+    auto* raw = static_cast<unsigned char*>(std::malloc(size + HEADER));
+    if (!raw) return nullptr;
+    *reinterpret_cast<size_t*>(raw) = size;
+    count_alloc();
+    track_lv(static_cast<ptrdiff_t>(size), 1);
+    return raw + HEADER;
+}
+
+void lv_free_core(void* p) {
+    if (!p) return;
+    unsigned char* raw = static_cast<unsigned char*>(p) - HEADER;
+    track_lv(-static_cast<ptrdiff_t>(*reinterpret_cast<size_t*>(raw)), -1);
+    std::free(raw);
+}
+
+void* lv_realloc_core(void* p, size_t new_size) {
+    if (!p) return lv_malloc_core(new_size);
+    unsigned char* raw = static_cast<unsigned char*>(p) - HEADER;
+    size_t old_size = *reinterpret_cast<size_t*>(raw);
+    auto* grown = static_cast<unsigned char*>(std::realloc(raw, new_size + HEADER));
+    if (!grown) return nullptr;
+    *reinterpret_cast<size_t*>(grown) = new_size;
+    count_alloc();
+    track_lv(static_cast<ptrdiff_t>(new_size) - static_cast<ptrdiff_t>(old_size), 0);
+    return grown + HEADER;
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t* mon_p) {
+    lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
+    mon_p->used_cnt = lv_used_blocks.load();
+    // The heap is unbounded: report it as exactly full so total - free = used
+    mon_p->total_size = lv_used_bytes.load();
+    mon_p->max_used = lv_max_used_bytes.load();
+}
+
+lv_result_t lv_mem_test_core(void) {
+    return LV_RESULT_OK;
+}
+
+}  // extern "C"
+
+// ----------------------------------------------------------------------------
+// C++ allocations (widget containers, callbacks, unique_ptr children)
+// ----------------------------------------------------------------------------
+void* operator new(size_t size) {
+    count_alloc();
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    count_alloc();
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    std::free(p);
+}
+
+#if DEMO_BENCH_WRAP_MALLOC
+// ----------------------------------------------------------------------------
+// malloc/calloc/realloc of the whole executable (LVGL, SDL, the library and
+// the demo), linked with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc
+// ----------------------------------------------------------------------------
+extern "C" {
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* p, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* p, size_t size) {
+    alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __real_realloc(p, size);
+}
+
+}  // extern "C"
+#endif
+
+#else
+
+namespace BenchAlloc {
+
+bool available() {
+    return false;
+}
+
+uint64_t count() {
+    return 0;
+}
+
+}  // namespace BenchAlloc
+
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+// ============================================================================
+// Allocation counting for --bench
+//
+// Built with -DDEMO_BENCH=ON, LVGL uses LV_STDLIB_CUSTOM backed by the
+// counting allocator in BenchAlloc.cpp, and global operator new/delete are
+// counted too (widget-side std::vector, std::function, unique_ptr...).
+// With GNU-style linkers, malloc/calloc/realloc are also wrapped
+// (-Wl,--wrap=malloc, DEMO_BENCH_WRAP_MALLOC): every C allocation of the
+// executable is counted once, at the malloc level.
+// Without DEMO_BENCH, available() is false and allocation metrics are skipped.
+// ============================================================================
+namespace BenchAlloc {
+
+bool available();
+
+// Total allocations (LVGL + C++ + malloc when wrapped) since start
+uint64_t count();
+
+}  // namespace BenchAlloc
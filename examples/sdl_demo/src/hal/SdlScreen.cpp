@@ -0,0 +1,124 @@
+#include "SdlScreen.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+
+Uint32 sdl_pixel_format(lv_color_format_t format) {
+    switch (format) {
+        case LV_COLOR_FORMAT_RGB565: return SDL_PIXELFORMAT_RGB565;
+        case LV_COLOR_FORMAT_ARGB8888: return SDL_PIXELFORMAT_ARGB8888;
+        case LV_COLOR_FORMAT_XRGB8888: return SDL_PIXELFORMAT_RGB888;
+        default: return SDL_PIXELFORMAT_UNKNOWN;
+    }
+}
+
+}  // namespace
+
+bool SdlScreen::init(SDL_Renderer* renderer, int32_t width, int32_t height, lv_color_format_t format) {
+    destroy();
+
+    renderer_ = renderer;
+    width_ = width;
+    height_ = height;
+    format_ = format;
+    if (!createTexture()) return false;
+
+    display_ = lv_display_create(width, height);
+    lv_display_set_color_format(display_, format);
+    lv_display_set_driver_data(display_, this);
+
+    uint32_t stride = lv_draw_buf_width_to_stride(width, format);
+    buf_.resize(static_cast<size_t>(stride) * (height / BUF_DIVISOR));
+    lv_display_set_buffers(display_, buf_.data(), nullptr, static_cast<uint32_t>(buf_.size()),
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(display_, flushCallback);
+    return true;
+}
+
+bool SdlScreen::createTexture() {
+    Uint32 sdl_format = sdl_pixel_format(format_);
+    if (sdl_format == SDL_PIXELFORMAT_UNKNOWN) {
+        std::printf("SdlScreen: unsupported color format %d\n", static_cast<int>(format_));
+        return false;
+    }
+    texture_ = SDL_CreateTexture(renderer_, sdl_format, SDL_TEXTUREACCESS_STREAMING, width_, height_);
+    if (!texture_) {
+        std::printf("SdlScreen: %s\n", SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureBlendMode(texture_, lv_color_format_has_alpha(format_) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+    return true;
+}
+
+bool SdlScreen::resetTexture() {
+    if (!display_) return false;
+    if (texture_) {
+        SDL_DestroyTexture(texture_);
+        texture_ = nullptr;
+    }
+    if (!createTexture()) return false;
+    // Everything flushed so far was in the lost texture
+    lv_obj_invalidate(lv_display_get_screen_active(display_));
+    return true;
+}
+
+void SdlScreen::destroy() {
+    if (pointer_) {
+        lv_indev_delete(pointer_);
+        pointer_ = nullptr;
+    }
+    if (display_) {
+        lv_display_delete(display_);
+        display_ = nullptr;
+    }
+    if (texture_) {
+        SDL_DestroyTexture(texture_);
+        texture_ = nullptr;
+    }
+    buf_.clear();
+    buf_.shrink_to_fit();
+}
+
+lv_indev_t* SdlScreen::createPointer(int originX, int originY) {
+    if (!display_ || pointer_) return pointer_;
+    origin_x_ = originX;
+    origin_y_ = originY;
+    pointer_ = lv_indev_create();
+    lv_indev_set_type(pointer_, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(pointer_, pointerReadCallback);
+    lv_indev_set_display(pointer_, display_);
+    lv_indev_set_driver_data(pointer_, this);
+    return pointer_;
+}
+
+void SdlScreen::flushCallback(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    auto* self = static_cast<SdlScreen*>(lv_display_get_driver_data(disp));
+    if (self && self->texture_) {
+        SDL_Rect rect = {area->x1, area->y1, lv_area_get_width(area), lv_area_get_height(area)};
+        uint32_t stride = lv_draw_buf_width_to_stride(rect.w, lv_display_get_color_format(disp));
+        SDL_UpdateTexture(self->texture_, &rect, px_map, static_cast<int>(stride));
+        self->flushed_ = true;
+    }
+    lv_display_flush_ready(disp);
+}
+
+void SdlScreen::pointerReadCallback(lv_indev_t* indev, lv_indev_data_t* data) {
+    auto* self = static_cast<SdlScreen*>(lv_indev_get_driver_data(indev));
+    if (!self) return;
+
+    int mx = 0, my = 0;
+    Uint32 buttons = SDL_GetMouseState(&mx, &my);
+    int x = mx - self->origin_x_;
+    int y = my - self->origin_y_;
+    bool inside = x >= 0 && y >= 0 && x < self->width_ && y < self->height_;
+
+    // Presses start inside the screen; a drag keeps going when it leaves it
+    bool down = (buttons & SDL_BUTTON_LMASK) != 0;
+    self->pointer_pressed_ = down && (inside || self->pointer_pressed_);
+
+    data->point.x = std::clamp(x, 0, static_cast<int>(self->width_) - 1);
+    data->point.y = std::clamp(y, 0, static_cast<int>(self->height_) - 1);
+    data->state = self->pointer_pressed_ ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
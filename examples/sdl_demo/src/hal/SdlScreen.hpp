@@ -0,0 +1,79 @@
+#pragma once
+
+#include <SDL.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "lvgl.h"
+
+// ============================================================================
+// SdlScreen - LVGL display rendered into an SDL streaming texture
+//
+// The display has the device's resolution and color format and renders in
+// PARTIAL mode into a 1/BUF_DIVISOR screen buffer, like the firmware does.
+// Each flushed area is uploaded into the texture, which main.cpp composites
+// into the simulator window at the screen position. Desktop frame timings
+// therefore cover the same pixel count and depth as the device.
+//
+// Input is the pointer only, like the device's touch screen: unlike LVGL's
+// SDL driver, there are no keyboard / mousewheel indevs and no default
+// lv_group (the hardware controls come from the simulator panel).
+// ============================================================================
+class SdlScreen {
+public:
+    static constexpr int BUF_DIVISOR = 10;  // Draw buffer = 1/10 screen
+
+    SdlScreen() = default;
+    ~SdlScreen() { destroy(); }
+    SdlScreen(const SdlScreen&) = delete;
+    SdlScreen& operator=(const SdlScreen&) = delete;
+
+    // Create display + texture (RGB565, ARGB8888 or XRGB8888)
+    bool init(SDL_Renderer* renderer, int32_t width, int32_t height, lv_color_format_t format);
+    void destroy();
+
+    // SDL_RENDER_DEVICE_RESET: the texture is gone, recreate it and redraw
+    // the whole screen into it
+    bool resetTexture();
+
+    // Pointer input from the SDL mouse, in window coordinates with the
+    // screen composited at (originX, originY)
+    lv_indev_t* createPointer(int originX, int originY);
+
+    // Process the pointer immediately (on SDL mouse events) instead of at
+    // the indev's next periodic read
+    void readPointer() {
+        if (pointer_) lv_indev_read(pointer_);
+    }
+
+    lv_display_t* display() const { return display_; }
+    SDL_Texture* texture() const { return texture_; }
+    int32_t width() const { return width_; }
+    int32_t height() const { return height_; }
+
+    // True once after LVGL flushed into the texture (recomposite needed)
+    bool takeFlushed() {
+        bool flushed = flushed_;
+        flushed_ = false;
+        return flushed;
+    }
+
+private:
+    bool createTexture();
+    static void flushCallback(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map);
+    static void pointerReadCallback(lv_indev_t* indev, lv_indev_data_t* data);
+
+    SDL_Renderer* renderer_ = nullptr;
+    lv_display_t* display_ = nullptr;
+    lv_indev_t* pointer_ = nullptr;
+    SDL_Texture* texture_ = nullptr;
+    lv_color_format_t format_ = LV_COLOR_FORMAT_RGB565;
+    std::vector<uint8_t> buf_;
+    int32_t width_ = 0;
+    int32_t height_ = 0;
+    int origin_x_ = 0;
+    int origin_y_ = 0;
+    bool pointer_pressed_ = false;
+    bool flushed_ = false;
+};
@@ -3,6 +3,25 @@
 #include <cmath>
 #include <algorithm>
 
+// Value arc geometry (from 7 o'clock, clockwise)
+static constexpr int ARC_START_DEGREES = 135;
+static constexpr int ARC_SWEEP_DEGREES = 270;
+static constexpr int ARC_THICKNESS = 8;
+
+// Triangle list indices for a strip of ARC_SWEEP_DEGREES quads (shared by all encoders)
+static const std::vector<int>& arcIndices() {
+    static const std::vector<int> indices = [] {
+        std::vector<int> list;
+        list.reserve(ARC_SWEEP_DEGREES * 6);
+        for (int i = 0; i < ARC_SWEEP_DEGREES; i++) {
+            int o = i * 2;  // outer(i), inner(i), outer(i+1), inner(i+1)
+            list.insert(list.end(), {o, o + 1, o + 2, o + 1, o + 3, o + 2});
+        }
+        return list;
+    }();
+    return indices;
+}
+
 // Helper to extract RGB from uint32_t color
 static void colorToRGB(uint32_t color, Uint8& r, Uint8& g, Uint8& b) {
     r = (color >> 16) & 0xFF;
@@ -20,16 +39,29 @@ bool HwButton::hitTest(int mx, int my) const {
     return (dx * dx + dy * dy) <= (radius * radius);
 }
 
-void HwButton::render(SDL_Renderer* renderer) const {
+SDL_Rect HwButton::bounds() const {
+    return {x - radius - 2, y - radius - 2, radius * 2 + 5, radius * 2 + 5};
+}
+
+void HwButton::renderBody(SDL_Renderer* renderer) const {
     Uint8 r, g, b;
     colorToRGB(color, r, g, b);
 
+    // Filled circle with anti-aliased edge
+    filledCircleRGBA(renderer, x, y, radius, r, g, b, 255);
+    aacircleRGBA(renderer, x, y, radius, r, g, b, 255);      // Same color AA edge
+    aacircleRGBA(renderer, x, y, radius + 1, 40, 40, 40, 180); // Subtle dark outline
+}
+
+void HwButton::renderState(SDL_Renderer* renderer) const {
+    if (!pressed) return;  // Released look is the baked body
+
     // Darken if pressed
-    if (pressed) {
-        r = static_cast<Uint8>(r * 0.7f);
-        g = static_cast<Uint8>(g * 0.7f);
-        b = static_cast<Uint8>(b * 0.7f);
-    }
+    Uint8 r, g, b;
+    colorToRGB(color, r, g, b);
+    r = static_cast<Uint8>(r * 0.7f);
+    g = static_cast<Uint8>(g * 0.7f);
+    b = static_cast<Uint8>(b * 0.7f);
 
     // Filled circle with anti-aliased edge
     filledCircleRGBA(renderer, x, y, radius, r, g, b, 255);
@@ -47,7 +79,37 @@ bool HwEncoder::hitTest(int mx, int my) const {
     return (dx * dx + dy * dy) <= (radius * radius);
 }
 
-void HwEncoder::render(SDL_Renderer* renderer) const {
+SDL_Rect HwEncoder::bounds() const {
+    return {x - radius - 2, y - radius - 2, radius * 2 + 5, radius * 2 + 5};
+}
+
+int HwEncoder::arcSegments() const {
+    if (isRelative) return 0;
+    return std::clamp(static_cast<int>(value * ARC_SWEEP_DEGREES), 0, ARC_SWEEP_DEGREES);
+}
+
+void HwEncoder::buildArc() {
+    arcStrip.clear();
+    if (isRelative) return;
+
+    Uint8 r, g, b;
+    colorToRGB(color, r, g, b);
+    SDL_Color c = {r, g, b, 255};
+
+    // Same band as the former per-degree AA rings: radius down to radius - thickness
+    float outer = static_cast<float>(radius);
+    float inner = static_cast<float>(std::max(radius - ARC_THICKNESS, radius / 2));
+    arcStrip.reserve((ARC_SWEEP_DEGREES + 1) * 2);
+    for (int i = 0; i <= ARC_SWEEP_DEGREES; i++) {
+        float rad = (ARC_START_DEGREES + i) * static_cast<float>(M_PI) / 180.0f;
+        float cs = cosf(rad);
+        float sn = sinf(rad);
+        arcStrip.push_back({{x + outer * cs, y + outer * sn}, c, {0.0f, 0.0f}});
+        arcStrip.push_back({{x + inner * cs, y + inner * sn}, c, {0.0f, 0.0f}});
+    }
+}
+
+void HwEncoder::renderBody(SDL_Renderer* renderer) const {
     Uint8 r, g, b;
     colorToRGB(color, r, g, b);
 
@@ -58,37 +120,11 @@ void HwEncoder::render(SDL_Renderer* renderer) const {
     filledCircleRGBA(renderer, x, y, radius, bgR, bgG, bgB, 255);
     aacircleRGBA(renderer, x, y, radius, bgR, bgG, bgB, 255);
 
-    // Value arc (from 7 o'clock to current value) - thicker with AA
-    if (!isRelative) {
-        int startAngle = 135;
-        int endAngle = 135 + static_cast<int>(value * 270);
-
-        // Draw thick arc with multiple AA lines
-        int arcThickness = 8;
-        for (int thickness = 0; thickness < arcThickness; thickness++) {
-            int currentRadius = radius - thickness;
-            if (currentRadius < radius / 2) break;
-
-            for (int angle = startAngle; angle < endAngle && angle < startAngle + 270; angle++) {
-                float rad = angle * M_PI / 180.0f;
-                float radNext = (angle + 1) * M_PI / 180.0f;
-                int x1 = x + static_cast<int>(currentRadius * cosf(rad));
-                int y1 = y + static_cast<int>(currentRadius * sinf(rad));
-                int x2 = x + static_cast<int>(currentRadius * cosf(radNext));
-                int y2 = y + static_cast<int>(currentRadius * sinf(radNext));
-                aalineRGBA(renderer, x1, y1, x2, y2, r, g, b, 255);
-            }
-        }
-    }
-
     // Center button (if has button) with AA
     if (btnId >= 0) {
         int centerRadius = radius / 3;
-        Uint8 centerR = pressed ? static_cast<Uint8>(r * 0.5f) : r;
-        Uint8 centerG = pressed ? static_cast<Uint8>(g * 0.5f) : g;
-        Uint8 centerB = pressed ? static_cast<Uint8>(b * 0.5f) : b;
-        filledCircleRGBA(renderer, x, y, centerRadius, centerR, centerG, centerB, 255);
-        aacircleRGBA(renderer, x, y, centerRadius, centerR, centerG, centerB, 255);
+        filledCircleRGBA(renderer, x, y, centerRadius, r, g, b, 255);
+        aacircleRGBA(renderer, x, y, centerRadius, r, g, b, 255);
         aacircleRGBA(renderer, x, y, centerRadius + 1, 40, 40, 40, 120);
     }
 
@@ -97,6 +133,31 @@ void HwEncoder::render(SDL_Renderer* renderer) const {
     aacircleRGBA(renderer, x, y, radius + 1, 40, 40, 40, 150);
 }
 
+void HwEncoder::renderState(SDL_Renderer* renderer) const {
+    // Value arc (from 7 o'clock to current value): one geometry call
+    int segments = arcSegments();
+    if (segments > 0 && !arcStrip.empty()) {
+        SDL_RenderGeometry(renderer, nullptr, arcStrip.data(), static_cast<int>(arcStrip.size()),
+                           arcIndices().data(), segments * 6);
+        // Outer ring stays on top of the arc edge
+        aacircleRGBA(renderer, x, y, radius, 60, 60, 60, 200);
+        aacircleRGBA(renderer, x, y, radius + 1, 40, 40, 40, 150);
+    }
+
+    // Pressed center button
+    if (btnId >= 0 && pressed) {
+        Uint8 r, g, b;
+        colorToRGB(color, r, g, b);
+        int centerRadius = radius / 3;
+        Uint8 centerR = static_cast<Uint8>(r * 0.5f);
+        Uint8 centerG = static_cast<Uint8>(g * 0.5f);
+        Uint8 centerB = static_cast<Uint8>(b * 0.5f);
+        filledCircleRGBA(renderer, x, y, centerRadius, centerR, centerG, centerB, 255);
+        aacircleRGBA(renderer, x, y, centerRadius, centerR, centerG, centerB, 255);
+        aacircleRGBA(renderer, x, y, centerRadius + 1, 40, 40, 40, 120);
+    }
+}
+
 // ============================================================================
 // HwSimulator
 // ============================================================================
@@ -106,9 +167,22 @@ HwSimulator::HwSimulator() {
 }
 
 void HwSimulator::init(SDL_Renderer* renderer) {
+    releaseTextures();
     renderer_ = renderer;
 }
 
+void HwSimulator::invalidate() {
+    releaseTextures();
+    dirty_ = true;
+}
+
+void HwSimulator::releaseTextures() {
+    if (static_) SDL_DestroyTexture(static_);
+    if (frame_) SDL_DestroyTexture(frame_);
+    static_ = nullptr;
+    frame_ = nullptr;
+}
+
 void HwSimulator::setupControls() {
     using namespace HwLayout;
 
@@ -147,6 +221,47 @@ void HwSimulator::setupControls() {
             0.5f, false
         });
     }
+
+    for (auto& enc : encoders_) {
+        enc.buildArc();
+    }
+}
+
+bool HwSimulator::bake() {
+    using namespace HwLayout;
+
+    static_ = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, PANEL_SIZE, PANEL_SIZE);
+    frame_ = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, PANEL_SIZE, PANEL_SIZE);
+    if (!static_ || !frame_) {
+        releaseTextures();
+        return false;
+    }
+    SDL_SetTextureBlendMode(static_, SDL_BLENDMODE_NONE);
+    SDL_SetTextureBlendMode(frame_, SDL_BLENDMODE_NONE);
+
+    // Panel + released control bodies
+    SDL_SetRenderTarget(renderer_, static_);
+    SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 255);
+    SDL_RenderClear(renderer_);
+    renderPanel();
+    for (const auto& btn : buttons_) {
+        btn.renderBody(renderer_);
+    }
+    for (const auto& enc : encoders_) {
+        enc.renderBody(renderer_);
+    }
+
+    // Frame starts as the static layer; every control gets its state drawn
+    SDL_SetRenderTarget(renderer_, frame_);
+    SDL_RenderCopy(renderer_, static_, nullptr, nullptr);
+    SDL_SetRenderTarget(renderer_, nullptr);
+    for (auto& btn : buttons_) btn.drawn = false;
+    for (auto& enc : encoders_) enc.drawn = false;
+    return true;
+}
+
+void HwSimulator::restore(const SDL_Rect& rect) {
+    SDL_RenderCopy(renderer_, static_, &rect, &rect);
 }
 
 void HwSimulator::renderPanel() {
@@ -179,21 +294,41 @@ void HwSimulator::renderPanel() {
 
 void HwSimulator::render() {
     if (!renderer_) return;
-
-    renderPanel();
-
-    for (const auto& btn : buttons_) {
-        btn.render(renderer_);
+    if (!frame_ && !bake()) return;
+
+    // Redraw only controls whose state changed: static body back, then state
+    SDL_SetRenderTarget(renderer_, frame_);
+    for (auto& btn : buttons_) {
+        if (btn.drawn && btn.drawnPressed == btn.pressed) continue;
+        SDL_Rect rect = btn.bounds();
+        restore(rect);
+        btn.renderState(renderer_);
+        btn.drawn = true;
+        btn.drawnPressed = btn.pressed;
     }
-
-    for (const auto& enc : encoders_) {
-        enc.render(renderer_);
+    for (auto& enc : encoders_) {
+        int segments = enc.arcSegments();
+        if (enc.drawn && enc.drawnPressed == enc.pressed && enc.drawnSegments == segments) continue;
+        SDL_Rect rect = enc.bounds();
+        restore(rect);
+        enc.renderState(renderer_);
+        enc.drawn = true;
+        enc.drawnPressed = enc.pressed;
+        enc.drawnSegments = segments;
     }
+    SDL_SetRenderTarget(renderer_, nullptr);
 
+    SDL_RenderCopy(renderer_, frame_, nullptr, nullptr);
     renderLegend();
+    dirty_ = false;
 }
 
 void HwSimulator::handleEvent(const SDL_Event& event) {
+    // Motion only changes anything while an encoder is dragged
+    if (event.type != SDL_MOUSEMOTION || activeEncoder_) {
+        dirty_ = true;
+    }
+
     switch (event.type) {
         case SDL_MOUSEBUTTONDOWN: {
             int mx = event.button.x;
@@ -339,6 +474,7 @@ void HwSimulator::setEncoderValue(int encId, float value) {
     for (auto& enc : encoders_) {
         if (enc.encId == encId) {
             enc.value = std::clamp(value, 0.0f, 1.0f);
+            dirty_ = true;
             break;
         }
     }
@@ -381,10 +517,10 @@ void HwSimulator::renderLegend() {
     using namespace HwLayout;
 
     // Simple active control indicator in bottom-left corner of panel
-    if (activeControl_.type == ControlInfo::Type::NONE) return;
+    legendDrawn_ = legendActive();
+    if (!legendDrawn_) return;  // Only show for LEGEND_MS
 
     uint32_t elapsed = SDL_GetTicks() - activeControlTime_;
-    if (elapsed > 2000) return;  // Only show for 2 seconds
 
     // Indicator position (bottom-left, avoiding macro area)
     const int indicatorX = 60;
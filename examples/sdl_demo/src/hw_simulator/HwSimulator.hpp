@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SDL.h>
+#include <cstdint>
 #include <functional>
 #include <vector>
 #include <string>
@@ -176,8 +177,14 @@ struct HwButton {
     uint32_t color;
     bool pressed = false;
 
+    // Last drawn state (HwSimulator redraws only on change)
+    bool drawn = false;
+    bool drawnPressed = false;
+
     bool hitTest(int mx, int my) const;
-    void render(SDL_Renderer* renderer) const;
+    SDL_Rect bounds() const;
+    void renderBody(SDL_Renderer* renderer) const;   // Static: baked once
+    void renderState(SDL_Renderer* renderer) const;  // Pressed overlay
 };
 
 // Hardware encoder with optional button
@@ -192,8 +199,20 @@ struct HwEncoder {
     bool dragging = false;
     int dragStartY = 0;
 
+    // Value arc as a triangle strip (outer/inner vertex per degree), built once
+    std::vector<SDL_Vertex> arcStrip = {};
+
+    // Last drawn state (HwSimulator redraws only on change)
+    bool drawn = false;
+    bool drawnPressed = false;
+    int drawnSegments = -1;
+
     bool hitTest(int mx, int my) const;
-    void render(SDL_Renderer* renderer) const;
+    SDL_Rect bounds() const;
+    int arcSegments() const;  // Degrees of value arc to draw
+    void buildArc();
+    void renderBody(SDL_Renderer* renderer) const;   // Static: baked once
+    void renderState(SDL_Renderer* renderer) const;  // Value arc + pressed center
 };
 
 // Control info for legend display
@@ -211,10 +230,22 @@ class HwSimulator {
 public:
     HwSimulator();
 
+    static constexpr uint32_t LEGEND_MS = 2000;       // Active control indicator lifetime
+    static constexpr uint32_t LEGEND_FRAME_MS = 33;   // Pulse animation frame period
+
     void init(SDL_Renderer* renderer);
     void render();
+
+    // Drop the cached textures (render targets lost); rebaked on next render().
+    // Also call before destroying the renderer: the destructor doesn't touch
+    // SDL, the simulator may outlive it (static instance)
+    void invalidate();
     void handleEvent(const SDL_Event& event);
 
+    // Redraw scheduling: controls changed, or the legend is animating / fading out
+    bool needsRedraw() const { return dirty_ || legendActive() || legendDrawn_; }
+    uint32_t redrawDelayMs() const { return legendActive() ? LEGEND_FRAME_MS : UINT32_MAX; }
+
     // Callbacks
     void setButtonCallback(ButtonCallback cb) { buttonCallback_ = cb; }
     void setEncoderCallback(EncoderCallback cb) { encoderCallback_ = cb; }
@@ -233,6 +264,8 @@ public:
 
 private:
     SDL_Renderer* renderer_ = nullptr;
+    SDL_Texture* static_ = nullptr;  // Panel + control bodies, baked once
+    SDL_Texture* frame_ = nullptr;   // Static + current control states
     std::vector<HwButton> buttons_;
     std::vector<HwEncoder> encoders_;
 
@@ -245,7 +278,17 @@ private:
     ControlInfo activeControl_;
     uint32_t activeControlTime_ = 0;
 
+    bool dirty_ = true;         // Control state changed since last render
+    bool legendDrawn_ = false;  // Legend visible in the last render
+
+    bool legendActive() const {
+        return activeControl_.type != ControlInfo::Type::NONE && SDL_GetTicks() - activeControlTime_ <= LEGEND_MS;
+    }
+
     void setupControls();
+    bool bake();
+    void releaseTextures();
+    void restore(const SDL_Rect& rect);
     void renderPanel();
     void renderLegend();
     const char* getControlName(int id) const;
@@ -0,0 +1,141 @@
+#include "InputLog.hpp"
+
+#include <cstring>
+
+#include "lvgl.h"
+
+namespace {
+
+constexpr char MAGIC[4] = {'O', 'C', 'I', 'L'};
+
+struct Header {
+    char magic[4];
+    uint16_t version;
+    uint16_t record_size;
+};
+static_assert(sizeof(Header) == 8, "InputLog header must stay 8 bytes");
+
+// Virtual clock while a replay is running (lv_tick_set_cb takes a plain function)
+uint32_t replay_tick_ms = 0;
+
+}  // namespace
+
+// ============================================================================
+// InputRecorder
+// ============================================================================
+
+bool InputRecorder::begin(const char* path) {
+    end();
+    file_ = std::fopen(path, "wb");
+    if (!file_) {
+        std::printf("Record: cannot open %s\n", path);
+        return false;
+    }
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = InputLog::VERSION;
+    header.record_size = sizeof(InputLog::Record);
+    std::fwrite(&header, sizeof(header), 1, file_);
+
+    start_ms_ = lv_tick_get();
+    count_ = 0;
+    std::printf("Record: writing input to %s\n", path);
+    return true;
+}
+
+void InputRecorder::end() {
+    if (!file_) return;
+    std::fclose(file_);
+    file_ = nullptr;
+    std::printf("Record: %u events\n", static_cast<unsigned>(count_));
+}
+
+void InputRecorder::button(int id, bool pressed) {
+    write(InputLog::Kind::Button, id, pressed, 0.0f);
+}
+
+void InputRecorder::encoder(int id, float value) {
+    write(InputLog::Kind::Encoder, id, false, value);
+}
+
+void InputRecorder::write(InputLog::Kind kind, int id, bool pressed, float value) {
+    if (!file_) return;
+    InputLog::Record record;
+    record.tick_ms = lv_tick_elaps(start_ms_);
+    record.kind = static_cast<uint8_t>(kind);
+    record.pressed = pressed ? 1 : 0;
+    record.id = static_cast<int16_t>(id);
+    record.value = value;
+    std::fwrite(&record, sizeof(record), 1, file_);
+    count_++;
+}
+
+// ============================================================================
+// InputReplayer
+// ============================================================================
+
+bool InputReplayer::load(const char* path) {
+    records_.clear();
+    next_ = 0;
+
+    FILE* file = std::fopen(path, "rb");
+    if (!file) {
+        std::printf("Replay: cannot open %s\n", path);
+        return false;
+    }
+    Header header;
+    bool valid = std::fread(&header, sizeof(header), 1, file) == 1 &&
+                 std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+                 header.version == InputLog::VERSION && header.record_size == sizeof(InputLog::Record);
+    if (!valid) {
+        std::printf("Replay: %s is not an input log (version %u)\n", path, static_cast<unsigned>(InputLog::VERSION));
+        std::fclose(file);
+        return false;
+    }
+
+    InputLog::Record record;
+    while (std::fread(&record, sizeof(record), 1, file) == 1) {
+        records_.push_back(record);
+    }
+    std::fclose(file);
+
+    std::printf("Replay: %u events, %.1f s from %s\n", static_cast<unsigned>(records_.size()),
+                durationMs() / 1000.0f, path);
+    return true;
+}
+
+void InputReplayer::start(ButtonCallback buttonCb, EncoderCallback encoderCb) {
+    buttonCallback_ = std::move(buttonCb);
+    encoderCallback_ = std::move(encoderCb);
+    next_ = 0;
+    elapsed_ms_ = 0;
+    replay_tick_ms = lv_tick_get();  // Continue from the current tick: no wrap for existing timers
+    lv_tick_set_cb(tickCallback);
+    active_ = true;
+}
+
+void InputReplayer::stop() {
+    if (!active_) return;
+    active_ = false;
+    lv_tick_set_cb(SDL_GetTicks);
+}
+
+void InputReplayer::step() {
+    replay_tick_ms += STEP_MS;
+    elapsed_ms_ += STEP_MS;
+
+    while (next_ < records_.size() && records_[next_].tick_ms <= elapsed_ms_) {
+        const InputLog::Record& record = records_[next_++];
+        if (record.kind == static_cast<uint8_t>(InputLog::Kind::Button)) {
+            if (buttonCallback_) buttonCallback_(record.id, record.pressed != 0);
+        } else if (encoderCallback_) {
+            encoderCallback_(record.id, record.value);
+        }
+    }
+
+    lv_timer_handler();
+}
+
+uint32_t InputReplayer::tickCallback() {
+    return replay_tick_ms;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "HwSimulator.hpp"
+
+// ============================================================================
+// Input recording / deterministic replay (--record, --replay)
+//
+// The recorder sits between HwSimulator and the demo's Button/Encoder
+// callbacks and appends each event, stamped with lv_tick_get() relative to
+// the start of the recording, to a compact binary log:
+//
+//   header  "OCIL" | u16 version | u16 record size
+//   record  u32 tick_ms | u8 kind | u8 pressed | i16 id | f32 value   (12 B)
+//
+// The replayer owns the LVGL clock while it runs: each step() advances a
+// virtual lv_tick by STEP_MS, fires the events due at that tick, then runs
+// lv_timer_handler(). The same log therefore produces the same sequence of
+// timer runs, animations and refreshes on every run, in the SDL demo and
+// headless.
+// ============================================================================
+
+namespace InputLog {
+
+constexpr uint16_t VERSION = 1;
+
+enum class Kind : uint8_t { Button = 0, Encoder = 1 };
+
+struct Record {
+    uint32_t tick_ms;  // Relative to the start of the recording
+    uint8_t kind;      // Kind
+    uint8_t pressed;   // Button state
+    int16_t id;        // HwId
+    float value;       // Encoder value or delta
+};
+static_assert(sizeof(Record) == 12, "InputLog::Record must stay 12 bytes");
+
+}  // namespace InputLog
+
+class InputRecorder {
+public:
+    ~InputRecorder() { end(); }
+
+    bool begin(const char* path);
+    void end();
+    bool isActive() const { return file_ != nullptr; }
+
+    void button(int id, bool pressed);
+    void encoder(int id, float value);
+
+private:
+    void write(InputLog::Kind kind, int id, bool pressed, float value);
+
+    FILE* file_ = nullptr;
+    uint32_t start_ms_ = 0;
+    uint32_t count_ = 0;
+};
+
+class InputReplayer {
+public:
+    static constexpr uint32_t STEP_MS = 1;  // Virtual time per step (~SDL_Delay(1) in the main loop)
+
+    bool load(const char* path);
+
+    // Take over lv_tick (call after the display driver has installed its own)
+    void start(ButtonCallback buttonCb, EncoderCallback encoderCb);
+
+    // Give lv_tick back to SDL (live input resumes)
+    void stop();
+
+    // Advance the virtual clock, fire due events, run lv_timer_handler()
+    void step();
+
+    bool isActive() const { return active_; }
+    bool finished() const { return next_ >= records_.size(); }
+    uint32_t elapsedMs() const { return elapsed_ms_; }
+    uint32_t durationMs() const { return records_.empty() ? 0 : records_.back().tick_ms; }
+    size_t eventCount() const { return records_.size(); }
+
+private:
+    static uint32_t tickCallback();
+
+    std::vector<InputLog::Record> records_;
+    size_t next_ = 0;
+    uint32_t elapsed_ms_ = 0;
+    bool active_ = false;
+    ButtonCallback buttonCallback_;
+    EncoderCallback encoderCallback_;
+};
@@ -0,0 +1,232 @@
+#include "InputStorm.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <oc/ui/lvgl/widget/KnobWidget.hpp>
+#include <oc/ui/lvgl/widget/Label.hpp>
+
+#include "HwSimulator.hpp"
+
+using oc::ui::lvgl::UpdateQueue;
+
+namespace {
+
+constexpr uint32_t BURST_ON_MS = 50;
+constexpr uint32_t BURST_OFF_MS = 200;
+constexpr float BURST_RATE_SCALE = 4.0f;
+constexpr float RANDOM_STEP = 0.01f;  // Random walk step (absolute) / delta (relative)
+
+}  // namespace
+
+bool InputStorm::parse(const char* spec, Options& options) {
+    const char* colon = std::strchr(spec, ':');
+    size_t name_len = colon ? static_cast<size_t>(colon - spec) : std::strlen(spec);
+    if (name_len == 5 && std::strncmp(spec, "sweep", 5) == 0) {
+        options.pattern = Pattern::Sweep;
+    } else if (name_len == 6 && std::strncmp(spec, "random", 6) == 0) {
+        options.pattern = Pattern::Random;
+    } else if (name_len == 5 && std::strncmp(spec, "burst", 5) == 0) {
+        options.pattern = Pattern::Burst;
+    } else {
+        std::printf("Storm: unknown pattern '%s' (sweep, random, burst)\n", spec);
+        return false;
+    }
+    if (colon) {
+        options.rate_hz = static_cast<float>(std::atof(colon + 1));
+        if (options.rate_hz <= 0.0f) {
+            std::printf("Storm: invalid rate in '%s'\n", spec);
+            return false;
+        }
+    }
+    return true;
+}
+
+void InputStorm::addFeedback(oc::ui::lvgl::KnobWidget& knob) {
+    UpdateQueue::Handle handle = feedback_.add(knob);
+    if (handle) feedback_targets_.push_back({handle, false});
+}
+
+void InputStorm::addFeedback(oc::ui::lvgl::Label& label) {
+    UpdateQueue::Handle handle = feedback_.add(label);
+    if (handle) feedback_targets_.push_back({handle, true});
+}
+
+InputStorm::~InputStorm() {
+    if (display_) lv_display_remove_event_cb_with_user_data(display_, refrEventCallback, this);
+}
+
+void InputStorm::start(const Options& options, StormEncoderCallback callback, lv_display_t* display) {
+    options_ = options;
+    callback_ = std::move(callback);
+    rng_ = options.seed ? options.seed : 1;
+    elapsed_ms_ = 0;
+    frames_ = 0;
+    refr_total_us_ = 0.0;
+    refr_max_us_ = 0.0;
+    feedback_pending_ = 0.0f;
+    feedback_next_ = 0;
+
+    channels_.clear();
+    for (int i = 0; i < 8; i++) {
+        channels_.push_back({HwId::MACRO_ENC_1 + i, false});
+    }
+    channels_.push_back({HwId::OPT_ENC, true});
+    channels_.push_back({HwId::NAV_ENC, true});
+
+    display_ = display;
+    if (display_) {
+        lv_display_add_event_cb(display_, refrEventCallback, LV_EVENT_REFR_START, this);
+        lv_display_add_event_cb(display_, refrEventCallback, LV_EVENT_REFR_READY, this);
+    }
+    if (options_.feedback_hz > 0.0f && !feedback_targets_.empty()) feedback_.attach();
+    started_at_ = std::chrono::steady_clock::now();
+    active_ = true;
+
+    static const char* PATTERN_NAMES[] = {"sweep", "random", "burst"};
+    std::printf("Storm: %s, %.0f Hz x %u encoders, %u ms\n", PATTERN_NAMES[static_cast<int>(options_.pattern)],
+                options_.rate_hz, static_cast<unsigned>(channels_.size()), static_cast<unsigned>(options_.duration_ms));
+    if (options_.feedback_hz > 0.0f) {
+        std::printf("Storm: feedback %.0f Hz over %u widgets\n", options_.feedback_hz,
+                    static_cast<unsigned>(feedback_targets_.size()));
+    }
+}
+
+void InputStorm::advance(uint32_t dt_ms) {
+    if (!active_) return;
+
+    for (uint32_t ms = 0; ms < dt_ms && !finished(); ms++) {
+        float rate = options_.rate_hz;
+        if (options_.pattern == Pattern::Burst) {
+            bool on = elapsed_ms_ % (BURST_ON_MS + BURST_OFF_MS) < BURST_ON_MS;
+            rate = on ? rate * BURST_RATE_SCALE : 0.0f;
+        }
+
+        for (uint32_t c = 0; c < channels_.size(); c++) {
+            Channel& channel = channels_[c];
+            channel.pending += rate / 1000.0f;
+            while (channel.pending >= 1.0f) {
+                channel.pending -= 1.0f;
+                emit(channel, c);
+            }
+        }
+
+        if (!feedback_targets_.empty()) {
+            feedback_pending_ += options_.feedback_hz / 1000.0f;
+            while (feedback_pending_ >= 1.0f) {
+                feedback_pending_ -= 1.0f;
+                emitFeedback();
+            }
+        }
+        elapsed_ms_++;
+    }
+}
+
+void InputStorm::emit(Channel& channel, uint32_t index) {
+    float value;
+    if (channel.relative) {
+        value = nextRandom() * RANDOM_STEP;
+    } else if (options_.pattern == Pattern::Sweep) {
+        // 1 s period, phase-shifted per encoder
+        float t = (elapsed_ms_ % 1000) / 1000.0f + index * 0.125f;
+        t -= static_cast<int>(t);
+        value = t < 0.5f ? t * 2.0f : 2.0f - t * 2.0f;
+        channel.value = value;
+    } else {
+        channel.value = std::clamp(channel.value + nextRandom() * RANDOM_STEP, 0.0f, 1.0f);
+        value = channel.value;
+    }
+
+    channel.events++;
+    if (channel.frame_events++ > 0) channel.coalesced++;
+    if (callback_ && !callback_(channel.id, value)) channel.noops++;
+}
+
+void InputStorm::emitFeedback() {
+    // Round robin over the targets, like a controller echoing its state
+    const FeedbackTarget& target = feedback_targets_[feedback_next_];
+    feedback_next_ = (feedback_next_ + 1) % feedback_targets_.size();
+
+    float value = nextRandom() * 0.5f + 0.5f;
+    if (target.text) {
+        char text[UpdateQueue::TEXT_MAX];
+        std::snprintf(text, sizeof(text), "CC %d", static_cast<int>(value * 127.0f));
+        feedback_.setText(target.handle, text);
+    } else {
+        feedback_.setValue(target.handle, value);
+    }
+}
+
+float InputStorm::nextRandom() {
+    // xorshift32: deterministic and cheap at kHz rates
+    rng_ ^= rng_ << 13;
+    rng_ ^= rng_ >> 17;
+    rng_ ^= rng_ << 5;
+    return (rng_ / 4294967295.0f) * 2.0f - 1.0f;
+}
+
+void InputStorm::refrEventCallback(lv_event_t* e) {
+    auto* storm = static_cast<InputStorm*>(lv_event_get_user_data(e));
+    if (!storm || !storm->active_) return;
+
+    auto now = std::chrono::steady_clock::now();
+    if (lv_event_get_code(e) == LV_EVENT_REFR_START) {
+        storm->refr_start_ = now;
+        return;
+    }
+
+    double us = std::chrono::duration<double, std::micro>(now - storm->refr_start_).count();
+    storm->frames_++;
+    storm->refr_total_us_ += us;
+    storm->refr_max_us_ = std::max(storm->refr_max_us_, us);
+    for (auto& channel : storm->channels_) {
+        channel.frame_events = 0;
+    }
+}
+
+void InputStorm::stop() {
+    if (!active_) return;
+    report();
+    active_ = false;
+    feedback_.detach();
+    if (display_) {
+        lv_display_remove_event_cb_with_user_data(display_, refrEventCallback, this);
+        display_ = nullptr;
+    }
+}
+
+void InputStorm::report() const {
+    std::printf("\nStorm: %-10s %9s %9s %9s\n", "encoder", "events", "coalesced", "no-op");
+    uint32_t total = 0, coalesced = 0, noops = 0;
+    for (const auto& channel : channels_) {
+        std::printf("Storm: %-10d %9u %9u %9u\n", channel.id, static_cast<unsigned>(channel.events),
+                    static_cast<unsigned>(channel.coalesced), static_cast<unsigned>(channel.noops));
+        total += channel.events;
+        coalesced += channel.coalesced;
+        noops += channel.noops;
+    }
+    float pct = total ? 100.0f / total : 0.0f;
+    std::printf("Storm: %u events in %u ms, %.1f%% coalesced, %.1f%% no-op\n", static_cast<unsigned>(total),
+                static_cast<unsigned>(elapsed_ms_), coalesced * pct, noops * pct);
+
+    if (options_.feedback_hz > 0.0f && !feedback_targets_.empty()) {
+        // Dropped: rejected by the full queue or overwritten before the drain
+        UpdateQueue::Stats stats = feedback_.stats();
+        uint32_t generated = stats.pushed + stats.rejected;
+        uint32_t dropped = stats.rejected + stats.folded;
+        std::printf("Storm: feedback %u updates, %u applied, %u dropped (%u queue full, %u overwritten), "
+                    "%.1f%% dropped\n",
+                    static_cast<unsigned>(generated), static_cast<unsigned>(stats.applied),
+                    static_cast<unsigned>(dropped), static_cast<unsigned>(stats.rejected),
+                    static_cast<unsigned>(stats.folded), generated ? dropped * 100.0f / generated : 0.0f);
+    }
+
+    double wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started_at_).count();
+    if (frames_ > 0) {
+        std::printf("Storm: %u refreshes, avg %.0f us, max %.0f us, refresh busy %.1f%% of %.0f ms wall\n",
+                    static_cast<unsigned>(frames_), refr_total_us_ / frames_, refr_max_us_,
+                    wall_ms > 0.0 ? refr_total_us_ / 10.0 / wall_ms : 0.0, wall_ms);
+    }
+}
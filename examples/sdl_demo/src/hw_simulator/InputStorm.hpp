@@ -0,0 +1,117 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "lvgl.h"
+
+#include <oc/ui/lvgl/UpdateQueue.hpp>
+
+namespace oc::ui::lvgl {
+class KnobWidget;
+class Label;
+}  // namespace oc::ui::lvgl
+
+// ============================================================================
+// InputStorm - synthetic high-rate encoder input (--storm pattern:rate_hz)
+//
+// Drives every macro encoder plus OPT_ENC and NAV_ENC at once, at up to
+// several kHz each, from the main loop (LVGL isn't thread safe, neither is
+// the real firmware's UI task). Patterns:
+//   sweep   triangle wave per encoder (phase-shifted)
+//   random  random walk (relative encoders get random deltas)
+//   burst   random walk in 50 ms bursts at 4x rate, then 200 ms silence
+//
+// Per encoder it counts events, events coalesced before the next refresh
+// (only the last one per frame can be seen) and no-ops (the handler reports
+// nothing changed: no widget bound, or below the widget's epsilon). Refresh
+// duration and LVGL busy time are measured on the display's REFR events.
+//
+// MIDI feedback on top (--storm-feedback <hz>): setValue/setText commands
+// for the widgets registered with addFeedback() go through an UpdateQueue
+// drained once per refresh period, as a MIDI thread's would. Feedback updates
+// rejected by the full queue or overwritten by a later one before the
+// drain are counted as dropped.
+// ============================================================================
+
+// Returns true if the update changed UI state
+using StormEncoderCallback = std::function<bool(int id, float value)>;
+
+class InputStorm {
+public:
+    enum class Pattern { Sweep, Random, Burst };
+
+    struct Options {
+        Pattern pattern = Pattern::Random;
+        float rate_hz = 1000.0f;       // Events per second, per encoder
+        uint32_t duration_ms = 10000;  // Then stop and report
+        uint32_t seed = 1;             // Same seed, same event sequence
+        float feedback_hz = 0.0f;      // Feedback updates per second, all targets (0 = off)
+    };
+
+    // "sweep:2000", "random", "burst:4000" (rate defaults to 1000 Hz)
+    static bool parse(const char* spec, Options& options);
+
+    ~InputStorm();
+
+    // Feedback targets (register before start)
+    void addFeedback(oc::ui::lvgl::KnobWidget& knob);
+    void addFeedback(oc::ui::lvgl::Label& label);
+
+    void start(const Options& options, StormEncoderCallback callback, lv_display_t* display);
+
+    // Generate the events due in the next dt_ms
+    void advance(uint32_t dt_ms);
+
+    // Print the summary and detach from the display
+    void stop();
+
+    bool isActive() const { return active_; }
+    bool finished() const { return elapsed_ms_ >= options_.duration_ms; }
+
+private:
+    struct Channel {
+        int id;
+        bool relative;
+        float value = 0.5f;
+        float pending = 0.0f;          // Fractional events carried over
+        uint32_t events = 0;
+        uint32_t coalesced = 0;
+        uint32_t noops = 0;
+        uint32_t frame_events = 0;     // Since the last refresh
+    };
+
+    struct FeedbackTarget {
+        oc::ui::lvgl::UpdateQueue::Handle handle;
+        bool text;
+    };
+
+    static void refrEventCallback(lv_event_t* e);
+    void emit(Channel& channel, uint32_t index);
+    void emitFeedback();
+    float nextRandom();  // -1..1
+    void report() const;
+
+    Options options_;
+    StormEncoderCallback callback_;
+    lv_display_t* display_ = nullptr;
+    std::vector<Channel> channels_;
+    uint32_t rng_ = 1;
+    uint32_t elapsed_ms_ = 0;
+    bool active_ = false;
+
+    // MIDI feedback
+    oc::ui::lvgl::UpdateQueue feedback_;
+    std::vector<FeedbackTarget> feedback_targets_;
+    float feedback_pending_ = 0.0f;
+    uint32_t feedback_next_ = 0;
+
+    // Frame-time impact
+    std::chrono::steady_clock::time_point refr_start_;
+    std::chrono::steady_clock::time_point started_at_;
+    uint32_t frames_ = 0;
+    double refr_total_us_ = 0.0;
+    double refr_max_us_ = 0.0;
+};
@@ -2,8 +2,13 @@
 #define SDL_MAIN_HANDLED
 #include <SDL.h>
 #include <SDL_syswm.h>
-#include "hal/hal.h"
+#include "hal/SdlScreen.hpp"
 #include "hw_simulator/HwSimulator.hpp"
+#include "hw_simulator/InputLog.hpp"
+#include "hw_simulator/InputStorm.hpp"
+#include "bench/Bench.hpp"
+#include "stats_hud/StatsHud.hpp"
+#include "trace/ChromeTrace.hpp"
 #include "SDL2_gfxPrimitives.h"
 
 #ifdef _WIN32
@@ -14,7 +19,11 @@
 #endif
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
 
 #include <oc/ui/lvgl/component/ParameterKnob.hpp>
 #include <oc/ui/lvgl/component/ParameterEnum.hpp>
@@ -39,13 +48,32 @@ static void enable_dark_title_bar(SDL_Window* window) {
 // Hardware simulator (full panel)
 static constexpr int PANEL_SIZE = HwLayout::PANEL_SIZE;  // 1013px (correct proportions)
 
-// LVGL screen size (embedded display)
+// LVGL screen size and format (embedded display)
 static constexpr int SCREEN_W = HwLayout::SCREEN_W;  // 320px
 static constexpr int SCREEN_H = HwLayout::SCREEN_H;  // 240px
+static constexpr lv_color_format_t SCREEN_FORMAT = LV_COLOR_FORMAT_RGB565;
+
+// Device screen: LVGL display at SCREEN_W x SCREEN_H, composited at the
+// simulator's screen rect
+static SdlScreen deviceScreen;
 
 // Hardware simulator instance
 static HwSimulator hwSim;
 
+// Input capture / deterministic replay of hardware events
+static InputRecorder inputRecorder;
+static InputReplayer inputReplayer;
+
+// Synthetic encoder load (--storm); per-event logging is off while it runs
+static InputStorm inputStorm;
+static bool log_input = true;
+
+#ifdef DEMO_STATS_HUD
+// Widget counters + sysmon overlay (own display, left strip of the panel)
+static StatsHud statsHud;
+static SdlScreen hudScreen;
+#endif
+
 
 // ============================================================================
 // Component storage
@@ -154,18 +182,248 @@ static void on_hw_button(int id, bool pressed) {
     }
 }
 
-static void on_hw_encoder(int id, float value) {
-    printf("Encoder %d value: %.3f\n", id, value);
-
+// Returns true if the event changed a widget
+static bool apply_hw_encoder(int id, float value) {
     // Link macro encoders to LVGL knobs
     int macroIndex = id - HwId::MACRO_ENC_1;
     if (macroIndex >= 0 && macroIndex < 4 && knob_params[macroIndex]) {
-        knob_params[macroIndex]->knob().setValue(value);
+        KnobWidget& knob = knob_params[macroIndex]->knob();
+        float before = knob.getValue();
+        knob.setValue(value);
+        return knob.getValue() != before;
+    }
+    return false;
+}
+
+static void on_hw_encoder(int id, float value) {
+    if (log_input) printf("Encoder %d value: %.3f\n", id, value);
+    apply_hw_encoder(id, value);
+}
+
+// Live hardware events go through the recorder (no-op unless --record)
+static void on_live_button(int id, bool pressed) {
+    inputRecorder.button(id, pressed);
+    on_hw_button(id, pressed);
+}
+
+static void on_live_encoder(int id, float value) {
+    inputRecorder.encoder(id, value);
+    on_hw_encoder(id, value);
+}
+
+// ============================================================================
+// Event-driven main loop helpers
+// ============================================================================
+
+static constexpr uint32_t MAX_WAIT_MS = 500;  // Upper bound when LVGL has no timer ready
+
+// Input-to-present latency: from an input event's SDL timestamp to the
+// SDL_RenderPresent that follows it, reported every REPORT_MS
+struct InputLatency {
+    static constexpr uint32_t REPORT_MS = 5000;
+    static constexpr uint32_t EXPIRE_MS = 2 * LV_DEF_REFR_PERIOD;  // Input that changed nothing
+
+    uint32_t pending_since = 0;
+    bool pending = false;
+    uint32_t count = 0;
+    uint32_t sum_ms = 0;
+    uint32_t max_ms = 0;
+    uint32_t last_report = 0;
+
+    void input(uint32_t timestamp) {
+        if (pending) return;  // Measure from the oldest unpresented input
+        pending = true;
+        pending_since = timestamp;
+    }
+
+    void expire() {
+        if (pending && SDL_GetTicks() - pending_since > EXPIRE_MS) pending = false;
+    }
+
+    void presented() {
+        uint32_t now = SDL_GetTicks();
+        if (pending) {
+            uint32_t ms = now - pending_since;
+            pending = false;
+            count++;
+            sum_ms += ms;
+            max_ms = std::max(max_ms, ms);
+        }
+        if (now - last_report < REPORT_MS) return;
+        last_report = now;
+        if (count == 0) return;
+        printf("Latency: input->present avg %.1f ms, max %u ms (%u inputs)\n",
+               static_cast<float>(sum_ms) / count, static_cast<unsigned>(max_ms), static_cast<unsigned>(count));
+        count = sum_ms = max_ms = 0;
+    }
+};
+static InputLatency latency;
+
+static bool in_rect(int x, int y, const SDL_Rect& r) {
+    return x >= r.x && x < r.x + r.w && y >= r.y && y < r.y + r.h;
+}
+
+static void handle_sdl_event(const SDL_Event& event, const SDL_Rect& screenRect) {
+    // Hardware input comes from the log while replaying
+    if (inputReplayer.isActive()) return;
+
+    if (event.type == SDL_MOUSEBUTTONDOWN ||
+        event.type == SDL_MOUSEBUTTONUP ||
+        event.type == SDL_MOUSEMOTION) {
+        latency.input(event.common.timestamp);
+        int mx = (event.type == SDL_MOUSEMOTION) ? event.motion.x : event.button.x;
+        int my = (event.type == SDL_MOUSEMOTION) ? event.motion.y : event.button.y;
+
+        if (in_rect(mx, my, screenRect)) {
+            // Inside LVGL area - read the pointer now instead of at its next poll
+            deviceScreen.readPointer();
+        } else {
+            // Outside LVGL area - hardware simulator handles it
+            hwSim.handleEvent(event);
+        }
+    } else if (event.type == SDL_MOUSEWHEEL) {
+        latency.input(event.common.timestamp);
+        int mx, my;
+        SDL_GetMouseState(&mx, &my);
+        if (!in_rect(mx, my, screenRect)) {
+            hwSim.handleEvent(event);
+        }
+    }
+}
+
+// ============================================================================
+// Headless replay (--replay <file> --headless)
+// ============================================================================
+
+static void headless_flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    (void)area;
+    (void)px_map;
+    lv_display_flush_ready(disp);
+}
+
+// Offscreen device screen (same size, format and buffer as SdlScreen)
+static lv_display_t* create_headless_display() {
+    static std::vector<uint8_t> buf;
+    lv_display_t* disp = lv_display_create(SCREEN_W, SCREEN_H);
+    lv_display_set_color_format(disp, SCREEN_FORMAT);
+    uint32_t stride = lv_draw_buf_width_to_stride(SCREEN_W, SCREEN_FORMAT);
+    buf.resize(static_cast<size_t>(stride) * (SCREEN_H / SdlScreen::BUF_DIVISOR));
+    lv_display_set_buffers(disp, buf.data(), nullptr, static_cast<uint32_t>(buf.size()),
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, headless_flush_cb);
+    return disp;
+}
+
+static int run_headless_replay() {
+    constexpr uint32_t TAIL_MS = 1000;  // Let flashes/animations after the last event settle
+
+    create_headless_display();
+    create_demo_ui();
+    inputReplayer.start(on_hw_button, on_hw_encoder);
+
+    using clock = std::chrono::steady_clock;
+    double total_us = 0.0, worst_us = 0.0;
+    uint32_t worst_ms = 0;
+    while (!inputReplayer.finished() || inputReplayer.elapsedMs() < inputReplayer.durationMs() + TAIL_MS) {
+        auto start = clock::now();
+        inputReplayer.step();
+        double us = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+        total_us += us;
+        if (us > worst_us) {
+            worst_us = us;
+            worst_ms = inputReplayer.elapsedMs();
+        }
+    }
+
+    printf("Replay: %u ms simulated in %.1f ms, slowest step %.0f us at t=%u ms\n",
+           static_cast<unsigned>(inputReplayer.elapsedMs()), total_us / 1000.0, worst_us,
+           static_cast<unsigned>(worst_ms));
+    return 0;
+}
+
+// Headless storm (--storm <spec> --headless): virtual 1 ms steps
+static uint32_t headless_ms = 0;
+
+static uint32_t headless_tick() {
+    return headless_ms;
+}
+
+// MIDI feedback targets of the storm: the macro knobs and the status label
+static void add_storm_feedback() {
+    for (auto* param : knob_params) {
+        if (param) inputStorm.addFeedback(param->knob());
+    }
+    if (status_label) inputStorm.addFeedback(*status_label);
+}
+
+static int run_headless_storm(const InputStorm::Options& options) {
+    lv_display_t* disp = create_headless_display();
+    create_demo_ui();
+    lv_tick_set_cb(headless_tick);
+
+    add_storm_feedback();
+
+    inputStorm.start(options, apply_hw_encoder, disp);
+    while (!inputStorm.finished()) {
+        headless_ms++;
+        inputStorm.advance(1);
+        lv_timer_handler();
     }
+    inputStorm.stop();
+    return 0;
 }
 
 int main(int argc, char **argv) {
-    (void)argc; (void)argv;
+    // Command line:
+    //   --trace <file.json>         write a Chrome/Perfetto trace
+    //   --bench                     run the headless benchmark and exit
+    //   --baselines <file>          compare bench results (exit 1 on regression, repeatable)
+    //   --update-baselines <file>   write bench results as new baselines
+    //   --filter <name>             only bench scenarios containing <name>
+    //   --frames <n>                measured frames per bench scenario
+    //   --record <file>             log hardware input to <file>
+    //   --replay <file>             replay a log on a virtual clock
+    //   --storm <pattern[:hz]>      synthetic encoder load (sweep, random, burst)
+    //   --storm-ms <n>              storm duration
+    //   --storm-feedback <hz>       MIDI feedback updates on top of the storm
+    //   --headless                  replay / storm without a window and exit
+    const char* trace_path = nullptr;
+    const char* record_path = nullptr;
+    const char* replay_path = nullptr;
+    bool headless = false;
+    bool storm = false;
+    InputStorm::Options storm_options;
+    bool bench = false;
+    Bench::Options bench_options;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--bench") == 0) {
+            bench = true;
+        } else if (std::strcmp(argv[i], "--baselines") == 0 && i + 1 < argc) {
+            bench_options.baselines.push_back(argv[++i]);
+        } else if (std::strcmp(argv[i], "--update-baselines") == 0 && i + 1 < argc) {
+            bench_options.update = argv[++i];
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            bench_options.filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            bench_options.frames = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            record_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replay_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--storm") == 0 && i + 1 < argc) {
+            if (!InputStorm::parse(argv[++i], storm_options)) return 1;
+            storm = true;
+        } else if (std::strcmp(argv[i], "--storm-ms") == 0 && i + 1 < argc) {
+            storm_options.duration_ms = static_cast<uint32_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (std::strcmp(argv[i], "--storm-feedback") == 0 && i + 1 < argc) {
+            storm_options.feedback_hz = std::max(0.0f, static_cast<float>(std::atof(argv[++i])));
+        } else if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        }
+    }
+    if (replay_path && !inputReplayer.load(replay_path)) return 1;
 
     // Platform-specific SDL hints (must be set before SDL_Init)
 #ifdef _WIN32
@@ -176,15 +434,54 @@ int main(int argc, char **argv) {
 #endif
 
     lv_init();
+    if (trace_path) ChromeTrace::begin(trace_path);
+
+    // Headless: offscreen displays on a virtual clock, no SDL window
+    if (bench) {
+        int rc = Bench::run(bench_options);
+        ChromeTrace::end();
+        lv_deinit();
+        return rc;
+    }
+    if (replay_path && headless) {
+        int rc = run_headless_replay();
+        ChromeTrace::end();
+        return rc;
+    }
+    if (storm) log_input = false;
+    if (storm && headless) {
+        int rc = run_headless_storm(storm_options);
+        ChromeTrace::end();
+        return rc;
+    }
 
-    // Create LVGL display at PANEL size (square - no legend, indicator is inside panel)
-    lv_display_t* disp = sdl_hal_init(PANEL_SIZE, PANEL_SIZE);
-    lv_sdl_window_set_title(disp, "Hardware Simulator");
+    // Simulator window at PANEL size (square - no legend, indicator is inside panel)
+    if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER) != 0) {
+        printf("SDL_Init failed: %s\n", SDL_GetError());
+        return 1;
+    }
+    SDL_Window* window = SDL_CreateWindow("Hardware Simulator", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
+                                          PANEL_SIZE, PANEL_SIZE, 0);
+    SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    lv_tick_set_cb(SDL_GetTicks);
 
-    // Get SDL window and renderer from LVGL
-    SDL_Window* window = lv_sdl_window_get_window(disp);
-    SDL_Renderer* renderer = static_cast<SDL_Renderer*>(lv_sdl_window_get_renderer(disp));
-    SDL_SetWindowPosition(window, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED);
+    // LVGL renders only the device screen (resolution + color depth of the hardware)
+    SDL_Rect screenRect = hwSim.getScreenRect();
+    deviceScreen.init(renderer, SCREEN_W, SCREEN_H, SCREEN_FORMAT);
+    deviceScreen.createPointer(screenRect.x, screenRect.y);
+#ifdef DEMO_STATS_HUD
+    // HUD strip on its own translucent display; sysmon stays off the device screen
+    SDL_Rect hudRect = StatsHud::compositeRect(PANEL_SIZE);
+    hudScreen.init(renderer, hudRect.w, hudRect.h, LV_COLOR_FORMAT_ARGB8888);
+    lv_obj_set_style_bg_opa(lv_display_get_screen_active(hudScreen.display()), LV_OPA_TRANSP, 0);
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(deviceScreen.display());
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(deviceScreen.display());
+#endif
+#endif
+    lv_display_set_default(deviceScreen.display());
 
 #ifdef _WIN32
     enable_dark_title_bar(window);
@@ -192,92 +489,115 @@ int main(int argc, char **argv) {
 
     // Initialize hardware simulator
     hwSim.init(renderer);
-    hwSim.setButtonCallback(on_hw_button);
-    hwSim.setEncoderCallback(on_hw_encoder);
+    hwSim.setButtonCallback(on_live_button);
+    hwSim.setEncoderCallback(on_live_encoder);
 
     // Create LVGL UI
     create_demo_ui();
+#ifdef DEMO_STATS_HUD
+    statsHud.init(lv_display_get_screen_active(hudScreen.display()));
+#endif
 
-    // Get screen rect for LVGL positioning
-    SDL_Rect screenRect = hwSim.getScreenRect();
+    // Replay owns lv_tick until the log ends
+    if (replay_path) {
+        inputReplayer.start(on_hw_button, on_hw_encoder);
+    } else if (record_path) {
+        inputRecorder.begin(record_path);
+    }
+    if (storm) {
+        add_storm_feedback();
+        inputStorm.start(storm_options, apply_hw_encoder, deviceScreen.display());
+    }
+    uint32_t storm_last_tick = SDL_GetTicks();
+
+    // Main loop: block until input or the next LVGL deadline, recomposite
+    // only when a screen flushed or the simulator changed
+    uint32_t time_till_next = 0;
+    bool recomposite = true;
+    while (1) {
+        // Replay and storm run in 1 ms steps
+        uint32_t wait_ms = (inputReplayer.isActive() || inputStorm.isActive())
+                               ? 1
+                               : std::min({time_till_next, hwSim.redrawDelayMs(), MAX_WAIT_MS});
 
-    // Create render target texture for LVGL compositing
-    // This allows us to capture LVGL's rendering and composite it with hwSim
-    SDL_Texture* lvglTexture = SDL_CreateTexture(
-        renderer,
-        SDL_PIXELFORMAT_RGBA8888,
-        SDL_TEXTUREACCESS_TARGET,
-        PANEL_SIZE, PANEL_SIZE
-    );
-    SDL_SetTextureBlendMode(lvglTexture, SDL_BLENDMODE_BLEND);
-
-    // Main loop
-    while(1) {
-        // Handle SDL events (for hardware simulation)
         SDL_Event event;
-        while (SDL_PollEvent(&event)) {
+        bool has_event = SDL_WaitEventTimeout(&event, static_cast<int>(wait_ms)) != 0;
+        while (has_event) {
             if (event.type == SDL_QUIT) {
-                SDL_DestroyTexture(lvglTexture);
+                inputRecorder.end();
+                ChromeTrace::end();
+#ifdef DEMO_STATS_HUD
+                hudScreen.destroy();
+#endif
+                deviceScreen.destroy();
+                hwSim.invalidate();  // Its textures go with the renderer
+                SDL_DestroyRenderer(renderer);
+                SDL_DestroyWindow(window);
+                SDL_Quit();
                 return 0;
             }
-
-            // Adjust mouse coordinates for LVGL (offset by screen position)
-            if (event.type == SDL_MOUSEBUTTONDOWN ||
-                event.type == SDL_MOUSEBUTTONUP ||
-                event.type == SDL_MOUSEMOTION) {
-                // Check if inside LVGL screen area
-                int mx = (event.type == SDL_MOUSEMOTION) ? event.motion.x : event.button.x;
-                int my = (event.type == SDL_MOUSEMOTION) ? event.motion.y : event.button.y;
-
-                if (mx >= screenRect.x && mx < screenRect.x + screenRect.w &&
-                    my >= screenRect.y && my < screenRect.y + screenRect.h) {
-                    // Inside LVGL area - let LVGL handle it (coordinates will be wrong though)
-                    // For now, hardware sim won't capture these events
-                } else {
-                    // Outside LVGL area - hardware simulator handles it
-                    hwSim.handleEvent(event);
-                }
-            } else if (event.type == SDL_MOUSEWHEEL) {
-                // Check mouse position for wheel events
-                int mx, my;
-                SDL_GetMouseState(&mx, &my);
-                if (!(mx >= screenRect.x && mx < screenRect.x + screenRect.w &&
-                      my >= screenRect.y && my < screenRect.y + screenRect.h)) {
-                    hwSim.handleEvent(event);
-                }
+            if (event.type == SDL_WINDOWEVENT) recomposite = true;
+            if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET) {
+                hwSim.invalidate();  // Baked textures are gone
+                recomposite = true;
             }
+            if (event.type == SDL_RENDER_DEVICE_RESET) {
+                // Streaming textures are lost too: recreate, LVGL redraws them
+                deviceScreen.resetTexture();
+#ifdef DEMO_STATS_HUD
+                hudScreen.resetTexture();
+#endif
+            }
+            handle_sdl_event(event, screenRect);
+            has_event = SDL_PollEvent(&event) != 0;
         }
 
-        // Redirect LVGL rendering to our texture
-        // This way LVGL's internal SDL_RenderPresent won't show an incomplete frame
-        SDL_SetRenderTarget(renderer, lvglTexture);
+        if (inputStorm.isActive()) {
+            uint32_t now = SDL_GetTicks();
+            inputStorm.advance(now - storm_last_tick);
+            storm_last_tick = now;
+            if (inputStorm.finished()) {
+                inputStorm.stop();
+                log_input = true;
+            }
+        }
 
-        // LVGL timer handler renders to our texture
-        // Its internal SDL_RenderPresent will present the previous frame (unchanged)
-        uint32_t time_till_next = lv_timer_handler();
-        (void)time_till_next;
+        // LVGL timer handler renders; flushed areas land in the screen textures
+        if (inputReplayer.isActive()) {
+            inputReplayer.step();
+            if (inputReplayer.finished()) {
+                inputReplayer.stop();
+                printf("Replay: done after %u ms, live input resumed\n",
+                       static_cast<unsigned>(inputReplayer.elapsedMs()));
+            }
+        } else {
+            time_till_next = lv_timer_handler();
+        }
 
-        // Switch back to rendering to window
-        SDL_SetRenderTarget(renderer, NULL);
+        recomposite |= deviceScreen.takeFlushed();
+#ifdef DEMO_STATS_HUD
+        recomposite |= hudScreen.takeFlushed();
+#endif
+        if (!recomposite && !hwSim.needsRedraw()) {
+            latency.expire();
+            continue;
+        }
+        recomposite = false;
 
         // Clear and draw hwSim first (background)
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
         SDL_RenderClear(renderer);
         hwSim.render();
 
-        // Composite ONLY the LVGL screen area on top (not the full texture which has black background)
-        // This preserves hwSim in the areas outside the LVGL screen
-        SDL_Rect lvglScreenRect = {
-            HwLayout::SCREEN_X, HwLayout::SCREEN_Y,
-            HwLayout::SCREEN_W, HwLayout::SCREEN_H
-        };
-        SDL_RenderCopy(renderer, lvglTexture, &lvglScreenRect, &lvglScreenRect);
+        // Composite the device screen on top, at the simulator's screen rect
+        SDL_RenderCopy(renderer, deviceScreen.texture(), nullptr, &screenRect);
+#ifdef DEMO_STATS_HUD
+        SDL_RenderCopy(renderer, hudScreen.texture(), nullptr, &hudRect);
+#endif
 
         // Single present with everything composited
         SDL_RenderPresent(renderer);
-
-        // Small delay
-        SDL_Delay(1);
+        latency.presented();
     }
     return 0;
 }
@@ -290,16 +610,15 @@ static void create_demo_ui(void) {
     constexpr int GRID_ROWS = 2;
 
     lv_obj_t* scr = lv_screen_active();
-    // Make screen transparent so hardware sim shows through
-    lv_obj_set_style_bg_opa(scr, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(base_theme::color::BACKGROUND), 0);
     lv_obj_set_style_pad_all(scr, 0, 0);
 
     // ========================================================================
-    // Screen container - positioned at the "display" area of the hardware
+    // Screen container - fills the device display
     // ========================================================================
     lv_obj_t* screen_container = lv_obj_create(scr);
-    lv_obj_set_pos(screen_container, HwLayout::SCREEN_X, HwLayout::SCREEN_Y);
-    lv_obj_set_size(screen_container, HwLayout::SCREEN_W, HwLayout::SCREEN_H);
+    lv_obj_set_pos(screen_container, 0, 0);
+    lv_obj_set_size(screen_container, SCREEN_W, SCREEN_H);
     lv_obj_set_style_bg_color(screen_container, lv_color_hex(base_theme::color::BACKGROUND), 0);
     lv_obj_set_style_border_width(screen_container, 0, 0);
     lv_obj_set_style_pad_all(screen_container, 0, 0);
@@ -0,0 +1,69 @@
+#include "StatsHud.hpp"
+
+#include <cstdio>
+
+#include <oc/ui/lvgl/Stats.hpp>
+#include <oc/ui/lvgl/theme/BaseTheme.hpp>
+
+using namespace oc::ui::lvgl;
+
+#if OC_UI_LVGL_STATS
+
+void StatsHud::init(lv_obj_t* parent) {
+    label_ = lv_label_create(parent);
+    lv_obj_set_width(label_, STRIP_W);
+    lv_obj_align(label_, LV_ALIGN_LEFT_MID, 0, 0);
+    lv_obj_set_style_bg_color(label_, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_bg_opa(label_, LV_OPA_80, 0);
+    lv_obj_set_style_text_color(label_, lv_color_hex(base_theme::color::TEXT_PRIMARY), 0);
+    lv_obj_set_style_pad_all(label_, 6, 0);
+    lv_label_set_text(label_, "widget stats...");
+
+    stats::reset();
+    timer_ = lv_timer_create(timerCallback, PERIOD_MS, this);
+}
+
+void StatsHud::timerCallback(lv_timer_t* timer) {
+    auto* hud = static_cast<StatsHud*>(lv_timer_get_user_data(timer));
+    if (hud) hud->update();
+}
+
+void StatsHud::update() {
+    // One line per widget class, only non-zero counters (per PERIOD_MS)
+    char text[768];
+    int len = std::snprintf(text, sizeof(text), "Widgets / s");
+    for (int w = 0; w < stats::WIDGET_COUNT; w++) {
+        auto widget = static_cast<stats::Widget>(w);
+        bool any = false;
+        for (int c = 0; c < stats::COUNTER_COUNT; c++) {
+            auto counter = static_cast<stats::Counter>(c);
+            uint32_t count = stats::get(widget, counter);
+            if (count == 0 || len >= static_cast<int>(sizeof(text))) continue;
+            if (!any) {
+                len += std::snprintf(text + len, sizeof(text) - len, "\n%s:", stats::widgetName(widget));
+                any = true;
+            }
+            if (len < static_cast<int>(sizeof(text))) {
+                len += std::snprintf(text + len, sizeof(text) - len, " %s %u", stats::counterName(counter),
+                                     static_cast<unsigned>(count));
+            }
+        }
+    }
+    lv_label_set_text(label_, text);
+    stats::reset();
+}
+
+#else
+
+// Stats compiled out: the HUD stays empty
+void StatsHud::init(lv_obj_t* parent) {
+    (void)parent;
+}
+
+void StatsHud::timerCallback(lv_timer_t* timer) {
+    (void)timer;
+}
+
+void StatsHud::update() {}
+
+#endif
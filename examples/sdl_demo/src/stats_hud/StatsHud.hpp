@@ -0,0 +1,31 @@
+#pragma once
+
+#include <SDL.h>
+
+#include "lvgl.h"
+
+// ============================================================================
+// Stats HUD - per-widget counters next to LVGL's sysmon overlays
+//
+// Built only with -DDEMO_STATS_HUD=ON (which also defines OC_UI_LVGL_STATS=1
+// and enables LVGL's perf/mem monitors). Everything lives on a separate
+// translucent LVGL display, composited by main.cpp over a strip on the left
+// edge of the panel so the device screen keeps its real size.
+// ============================================================================
+class StatsHud {
+public:
+    static constexpr int STRIP_W = 230;          // Width of the HUD display / left strip
+    static constexpr uint32_t PERIOD_MS = 1000;  // Counters shown per second
+
+    void init(lv_obj_t* parent);
+
+    // Where the HUD display is composited (panel coordinates)
+    static SDL_Rect compositeRect(int panelSize) { return {0, 0, STRIP_W, panelSize}; }
+
+private:
+    static void timerCallback(lv_timer_t* timer);
+    void update();
+
+    lv_obj_t* label_ = nullptr;
+    lv_timer_t* timer_ = nullptr;
+};
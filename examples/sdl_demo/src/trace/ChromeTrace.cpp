@@ -0,0 +1,134 @@
+#include "ChromeTrace.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "lvgl.h"
+
+#if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
+
+namespace {
+
+constexpr size_t BUF_SIZE = 1024 * 1024;  // Records buffered before a flush
+
+FILE* trace_file = nullptr;
+bool first_event = true;
+
+uint64_t tick_us() {
+    using namespace std::chrono;
+    return static_cast<uint64_t>(
+        duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+// One builtin profiler record, systrace style:
+//   "   LVGL-<tid> [<cpu>] <sec>.<usec>: tracing_mark_write: <B|E>|<pid>|<tag>"
+void write_event(const char* line, const char* line_end) {
+    const char* tid_str = std::strstr(line, "LVGL-");
+    if (!tid_str || tid_str >= line_end) return;
+    int tid = std::atoi(tid_str + 5);
+
+    const char* ts_str = std::strstr(tid_str, "] ");
+    if (!ts_str || ts_str >= line_end) return;
+    unsigned long sec = 0, usec = 0;
+    if (std::sscanf(ts_str + 2, "%lu.%lu", &sec, &usec) != 2) return;
+
+    static constexpr char MARK[] = "tracing_mark_write: ";
+    const char* mark = std::strstr(ts_str, MARK);
+    if (!mark || mark >= line_end) return;
+    mark += sizeof(MARK) - 1;
+    char phase = mark[0];
+    if (phase != 'B' && phase != 'E') return;
+    const char* name = std::strchr(mark + 2, '|');
+    if (!name || name >= line_end) return;
+    name++;
+
+    // Widget scopes are "Class::method", LVGL tags are plain function names
+    bool is_widget = false;
+    for (const char* c = name; c + 1 < line_end; ++c) {
+        if (c[0] == ':' && c[1] == ':') { is_widget = true; break; }
+    }
+
+    std::fprintf(trace_file, "%s\n{\"name\":\"", first_event ? "" : ",");
+    for (const char* c = name; c < line_end && *c != '\r'; ++c) {
+        if (*c == '"' || *c == '\\') std::fputc('\\', trace_file);
+        std::fputc(*c, trace_file);
+    }
+    std::fprintf(trace_file, "\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%lu,\"pid\":1,\"tid\":%d}",
+                 is_widget ? "oc" : "lvgl", phase, sec * 1000000UL + usec, tid);
+    first_event = false;
+}
+
+void flush_cb(const char* buf) {
+    if (!trace_file || !buf) return;
+    while (*buf) {
+        const char* end = std::strchr(buf, '\n');
+        if (!end) end = buf + std::strlen(buf);
+        write_event(buf, end);
+        buf = *end ? end + 1 : end;
+    }
+}
+
+}  // namespace
+
+namespace ChromeTrace {
+
+bool begin(const char* path) {
+    if (trace_file) return true;
+    trace_file = std::fopen(path, "w");
+    if (!trace_file) {
+        std::printf("Trace: cannot open %s\n", path);
+        return false;
+    }
+    std::fprintf(trace_file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    first_event = true;
+
+    // Replace lv_init()'s default config: microsecond clock + JSON sink
+    lv_profiler_builtin_uninit();
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = BUF_SIZE;
+    config.tick_per_sec = 1000000;
+    config.tick_get_cb = tick_us;
+    config.flush_cb = flush_cb;
+    lv_profiler_builtin_init(&config);
+    lv_profiler_builtin_set_enable(true);
+
+    std::printf("Trace: recording to %s\n", path);
+    return true;
+}
+
+void end() {
+    if (!trace_file) return;
+    lv_profiler_builtin_flush();
+    lv_profiler_builtin_set_enable(false);
+    std::fprintf(trace_file, "\n]}\n");
+    std::fclose(trace_file);
+    trace_file = nullptr;
+}
+
+bool isActive() {
+    return trace_file != nullptr;
+}
+
+}  // namespace ChromeTrace
+
+#else
+
+namespace ChromeTrace {
+
+bool begin(const char* path) {
+    std::printf("Trace: %s not written, rebuild with -DDEMO_TRACE=ON\n", path);
+    return false;
+}
+
+void end() {}
+
+bool isActive() {
+    return false;
+}
+
+}  // namespace ChromeTrace
+
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+// ============================================================================
+// Chrome / Perfetto trace output
+//
+// Routes LVGL's builtin profiler (refresh, layout, draw, timers...) and the
+// widgets' OC_UI_TRACE_SCOPE markers into a Chrome trace-event JSON file,
+// loadable in chrome://tracing or ui.perfetto.dev. Widget scopes use the
+// "oc" category, LVGL's own records the "lvgl" category.
+//
+// Requires a build with -DDEMO_TRACE=ON (LV_USE_PROFILER=1).
+// ============================================================================
+namespace ChromeTrace {
+
+// Start recording to `path` (call after lv_init). False if unavailable.
+bool begin(const char* path);
+
+// Flush pending records and close the file
+void end();
+
+bool isActive();
+
+}  // namespace ChromeTrace
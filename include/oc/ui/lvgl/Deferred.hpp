@@ -0,0 +1,63 @@
+#pragma once
+
+/**
+ * @file Deferred.hpp
+ * @brief Updates of hidden widgets, applied once they become visible
+ *
+ * A widget whose object (or any ancestor) has LV_OBJ_FLAG_HIDDEN cannot be
+ * drawn, so its setters only store the new model value and register the
+ * widget here; LVGL work (arc angles, text layout, restyling) happens once,
+ * when it is visible again. Flashes requested while hidden are dropped.
+ *
+ * Pending widgets are applied by flush(), which IComponent::show()
+ * implementations, PageCache::show() and KnobWidget::setVisible(true) call
+ * right after unhiding. Nothing polls: hidden pages with pending updates
+ * cost nothing per frame, and code that unhides through plain LVGL calls
+ * must call flush() itself.
+ *
+ * LVGL thread only.
+ *
+ * Usage (custom page):
+ * @code
+ * void MyPage::show() {
+ *     lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN);
+ *     deferred::flush();  // Apply what changed while hidden, before drawing
+ * }
+ * @endcode
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+namespace oc::ui::lvgl::deferred {
+
+/** @brief Brings one widget's LVGL objects up to date with its model */
+using ApplyFn = void (*)(void* target);
+
+/** @brief True if obj or one of its ancestors is hidden */
+bool isHidden(const lv_obj_t* obj);
+
+/**
+ * @brief Queue target until obj is visible
+ *
+ * Callers keep a flag so a target is queued once; apply(target) runs once.
+ * Returns false (caller must apply now) when the queue is full, which only
+ * happens with OC_UI_LVGL_STATIC_ALLOC.
+ */
+bool defer(const lv_obj_t* obj, ApplyFn apply, void* target);
+
+/** @brief Drop target's pending entry (target applied directly or destroyed) */
+void cancel(void* target);
+
+/** @brief Point target's pending entry at its moved-to object */
+void retarget(void* from, void* to);
+
+/** @brief Apply every pending widget that is visible now; returns count */
+uint32_t flush();
+
+/** @brief Number of widgets waiting to become visible */
+size_t pending();
+
+}  // namespace oc::ui::lvgl::deferred
@@ -0,0 +1,53 @@
+#pragma once
+
+/**
+ * @file LeanObject.hpp
+ * @brief Style-free, inert LVGL objects for structural containers
+ *
+ * lv_obj_create() objects get the theme's styles (background, border,
+ * padding, radius, scrollbar) and are clickable and scrollable with scroll
+ * chaining; widgets used to undo that by hand. lean::create() starts from
+ * lv_obj_remove_style_all() instead (transparent, no border, padding or
+ * radius) and clears the input and scroll flags, so:
+ * - style lookups only walk the properties the widget sets
+ * - hit-testing passes through to the nearest clickable ancestor
+ * - scroll and scroll-chain handling skip the object
+ *
+ * Every container of the library is lean. Add back what an object needs,
+ * e.g. LV_OBJ_FLAG_CLICKABLE on an element that handles input:
+ * @code
+ * lv_obj_t* row = lean::create(parent);
+ * lv_obj_set_size(row, LV_PCT(100), LV_SIZE_CONTENT);
+ * lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+ *
+ * lv_obj_add_flag(knob.getElement(), LV_OBJ_FLAG_CLICKABLE);  // Interactive
+ * @endcode
+ */
+
+#include <cstdint>
+
+#include <lvgl.h>
+
+namespace oc::ui::lvgl::lean {
+
+/** @brief Flags lean objects clear: input, focus and scrolling behavior */
+constexpr uint32_t INERT_FLAGS = LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_CLICK_FOCUSABLE | LV_OBJ_FLAG_PRESS_LOCK |
+                                 LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_CHAIN | LV_OBJ_FLAG_SCROLL_ELASTIC |
+                                 LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_ON_FOCUS |
+                                 LV_OBJ_FLAG_SCROLL_WITH_ARROW | LV_OBJ_FLAG_SNAPPABLE;
+
+/** @brief Make an existing object lean (e.g. a widget class object after init) */
+inline void strip(lv_obj_t* obj) {
+    lv_obj_remove_style_all(obj);
+    lv_obj_remove_flag(obj, static_cast<lv_obj_flag_t>(INERT_FLAGS));
+    lv_obj_set_scrollbar_mode(obj, LV_SCROLLBAR_MODE_OFF);
+}
+
+/** @brief Plain lean container */
+inline lv_obj_t* create(lv_obj_t* parent) {
+    lv_obj_t* obj = lv_obj_create(parent);
+    strip(obj);
+    return obj;
+}
+
+}  // namespace oc::ui::lvgl::lean
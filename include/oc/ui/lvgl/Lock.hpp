@@ -0,0 +1,46 @@
+#pragma once
+
+/**
+ * @file Lock.hpp
+ * @brief RAII guard for LVGL's global lock (lv_lock / lv_unlock)
+ *
+ * Widgets are not thread safe: every method touches LVGL objects and must
+ * run while LVGL's global lock is held. Where that is already the case:
+ * - timer, animation and event callbacks (KnobWidget::flashTimerCallback,
+ *   Label::pauseTimerCallback, ...): lv_timer_handler() holds the lock
+ *   while it runs them
+ * - the task that calls lv_timer_handler(), as long as no other thread
+ *   uses LVGL
+ *
+ * Any other thread (e.g. a MIDI or network task updating values) wraps
+ * its widget calls in a LockScope. The lock is recursive, so taking it
+ * again from a callback is harmless.
+ *
+ * With LV_USE_OS == LV_OS_PTHREAD (or another OS) and
+ * LV_DRAW_SW_DRAW_UNIT_CNT > 1, draw units render on their own threads.
+ * They never call widget code: the refresh waits for them before
+ * lv_timer_handler() releases the lock. With LV_OS_NONE the lock is a no-op.
+ *
+ * Usage:
+ * @code
+ * void onMidiCC(int cc, int value) {   // MIDI thread
+ *     oc::ui::lvgl::LockScope lock;
+ *     knobs[cc].setValue(value / 127.0f);
+ * }
+ * @endcode
+ */
+
+#include <lvgl.h>
+
+namespace oc::ui::lvgl {
+
+class LockScope {
+public:
+    LockScope() { lv_lock(); }
+    ~LockScope() { lv_unlock(); }
+
+    LockScope(const LockScope&) = delete;
+    LockScope& operator=(const LockScope&) = delete;
+};
+
+}  // namespace oc::ui::lvgl
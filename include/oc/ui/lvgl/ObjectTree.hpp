@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief Object tree built by Label, EnumWidget and the Parameter* components
+ *
+ * Lean trees keep the same accessors with fewer LVGL objects:
+ * - Label: a single lv_label (getElement() == getLabel()), overflow
+ *   scrolled by LVGL itself (LV_LABEL_LONG_SCROLL), no measure timer
+ * - EnumWidget: line and content are children of the widget object
+ *   (inner() == getElement()), no inner flex column
+ * - Parameter*: flex column instead of a grid, lean labels, children not
+ *   clickable instead of bubbling events to the component
+ *
+ * Lean labels don't honor alignment() while scrolling and take LVGL's
+ * default scroll speed.
+ */
+enum class ObjectTree : uint8_t {
+    Standard,  ///< Wrapper containers, custom scroll animation (default)
+    Lean       ///< Minimum objects per widget
+};
+
+}  // namespace oc::ui::lvgl
@@ -4,6 +4,8 @@
 
 #include <lvgl.h>
 
+#include "Trace.hpp"
+
 namespace oc::ui::lvgl {
 
 /**
@@ -62,6 +64,7 @@ struct SquareSizePolicy {
      * @return Result with computed dimensions and modification flags
      */
     Result compute(lv_obj_t* container) const {
+        OC_UI_TRACE_SCOPE("SquareSizePolicy::compute");
         if (!container) {
             return {0, 0, false, false, false};
         }
@@ -0,0 +1,89 @@
+#pragma once
+
+/**
+ * @file StaticAlloc.hpp
+ * @brief Compile-time heap-free update mode
+ *
+ * Disabled by default. Build with -DOC_UI_LVGL_STATIC_ALLOC=1 so that, once
+ * a screen is built, updating it never allocates (no operator new / malloc,
+ * no lv_malloc):
+ * - Label and ButtonWidget keep their text in an inline buffer of
+ *   OC_UI_LVGL_TEXT_MAX bytes (lv_label_set_text_static) instead of LVGL's
+ *   heap copy; longer text is truncated. Label::setText(std::string) is
+ *   not available.
+ * - VirtualList keeps at most OC_UI_LVGL_LIST_MAX_SLOTS slots in a fixed
+ *   array and takes plain function pointers as callbacks (captureless
+ *   lambdas convert; reach owner state through VirtualSlot::userData)
+ * - Widgets create their flash / deferred-measure timers with the widget
+ *   instead of on first use
+ * - At most OC_UI_LVGL_DEFERRED_MAX hidden widgets wait for visibility
+ *   (Deferred.hpp); beyond that, updates of hidden widgets apply at once
+ *
+ * In every mode, components embed their widgets by value and widgets keep
+ * their one-shot timers paused between uses instead of recreating them.
+ *
+ * Still allocating, by design:
+ * - Construction and configuration (LVGL objects, timers, event
+ *   descriptors, KnobWidget::ribbonFeed(), ParameterPage pools on the
+ *   first pages that need them)
+ * - Auto-scrolling labels: every scroll cycle starts an lv_anim; disable
+ *   autoScroll() for strict zero
+ * - LVGL's own rendering (draw tasks, layers), which with
+ *   LV_STDLIB_BUILTIN comes from its fixed LV_MEM_SIZE pool, not the
+ *   system heap
+ */
+
+#ifndef OC_UI_LVGL_STATIC_ALLOC
+#define OC_UI_LVGL_STATIC_ALLOC 0
+#endif
+
+#ifndef OC_UI_LVGL_TEXT_MAX
+#define OC_UI_LVGL_TEXT_MAX 32  // Inline label text, including the terminator
+#endif
+
+#ifndef OC_UI_LVGL_LIST_MAX_SLOTS
+#define OC_UI_LVGL_LIST_MAX_SLOTS 16
+#endif
+
+#ifndef OC_UI_LVGL_DEFERRED_MAX
+#define OC_UI_LVGL_DEFERRED_MAX 128  // Hidden widgets with pending updates (see Deferred.hpp)
+#endif
+
+#include <cstddef>
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief Fixed-capacity stand-in for the std::vector subset used by widgets
+ *
+ * push_back() beyond N is ignored: callers clamp their counts to N.
+ */
+template <typename T, size_t N>
+class FixedVector {
+public:
+    void reserve(size_t) {}
+    void clear() { size_ = 0; }
+    void push_back(const T& value) {
+        if (size_ < N) items_[size_++] = value;
+    }
+    void pop_back() {
+        if (size_ > 0) size_--;
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    static constexpr size_t capacity() { return N; }
+
+    T& operator[](size_t i) { return items_[i]; }
+    const T& operator[](size_t i) const { return items_[i]; }
+    T* begin() { return items_; }
+    T* end() { return items_ + size_; }
+    const T* begin() const { return items_; }
+    const T* end() const { return items_ + size_; }
+
+private:
+    T items_[N] = {};
+    size_t size_ = 0;
+};
+
+}  // namespace oc::ui::lvgl
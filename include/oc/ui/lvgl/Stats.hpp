@@ -0,0 +1,112 @@
+#pragma once
+
+/**
+ * @file Stats.hpp
+ * @brief Compile-time optional per-widget performance counters
+ *
+ * Disabled by default: every OC_UI_STAT* macro expands to nothing and the
+ * widgets carry no extra state. Build with -DOC_UI_LVGL_STATS=1 to count,
+ * per widget class:
+ * - setter calls vs. calls that actually changed something
+ * - geometry recomputes
+ * - timers / animations created
+ * - VirtualList slot binds
+ * - Label re-measurements
+ * - updates deferred while hidden
+ * - flashes shown
+ *
+ * Counters are plain (non-atomic) integers: widgets only run with LVGL's
+ * lock held (see Lock.hpp), never on draw threads.
+ *
+ * Instrumentation (in widget sources):
+ * @code
+ * OC_UI_STAT(Knob, SetterCalls);
+ * if (unchanged) return;
+ * OC_UI_STAT(Knob, SetterChanges);
+ * @endcode
+ *
+ * Reading:
+ * @code
+ * #if OC_UI_LVGL_STATS
+ * using namespace oc::ui::lvgl::stats;
+ * uint32_t binds = get(Widget::VirtualList, Counter::Binds);
+ * reset();
+ * #endif
+ * @endcode
+ */
+
+#include <cstdint>
+
+#ifndef OC_UI_LVGL_STATS
+#define OC_UI_LVGL_STATS 0
+#endif
+
+namespace oc::ui::lvgl::stats {
+
+enum class Widget : uint8_t {
+    Knob,
+    Enum,
+    Button,
+    StateIndicator,
+    Label,
+    VirtualList,
+    COUNT
+};
+
+enum class Counter : uint8_t {
+    SetterCalls,    ///< Data/style setter invoked
+    SetterChanges,  ///< ... and something actually changed
+    Geometry,       ///< updateGeometry() recomputes
+    Timers,         ///< lv_timer_create()
+    Anims,          ///< lv_anim_start()
+    Binds,          ///< VirtualList bind callback invocations
+    Measures,       ///< Label text measurements (layout forced)
+    Deferred,       ///< Setter stored while hidden (applied when shown)
+    Flashes,        ///< Change flashes started (after rate limiting)
+    COUNT
+};
+
+constexpr const char* widgetName(Widget w) {
+    constexpr const char* NAMES[] = {"Knob", "Enum", "Button", "Indicator", "Label", "List"};
+    return NAMES[static_cast<int>(w)];
+}
+
+constexpr const char* counterName(Counter c) {
+    constexpr const char* NAMES[] = {"set", "chg", "geo", "tmr", "anim", "bind", "meas", "defer", "flash"};
+    return NAMES[static_cast<int>(c)];
+}
+
+#if OC_UI_LVGL_STATS
+
+constexpr int WIDGET_COUNT = static_cast<int>(Widget::COUNT);
+constexpr int COUNTER_COUNT = static_cast<int>(Counter::COUNT);
+
+inline uint32_t (&table())[WIDGET_COUNT][COUNTER_COUNT] {
+    static uint32_t counts[WIDGET_COUNT][COUNTER_COUNT] = {};
+    return counts;
+}
+
+inline void add(Widget w, Counter c, uint32_t n = 1) {
+    table()[static_cast<int>(w)][static_cast<int>(c)] += n;
+}
+
+inline uint32_t get(Widget w, Counter c) {
+    return table()[static_cast<int>(w)][static_cast<int>(c)];
+}
+
+inline void reset() {
+    for (auto& row : table()) {
+        for (auto& count : row) count = 0;
+    }
+}
+
+#endif  // OC_UI_LVGL_STATS
+
+}  // namespace oc::ui::lvgl::stats
+
+#if OC_UI_LVGL_STATS
+#define OC_UI_STAT(widget, counter) \
+    ::oc::ui::lvgl::stats::add(::oc::ui::lvgl::stats::Widget::widget, ::oc::ui::lvgl::stats::Counter::counter)
+#else
+#define OC_UI_STAT(widget, counter) ((void)0)
+#endif
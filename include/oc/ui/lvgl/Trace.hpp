@@ -0,0 +1,52 @@
+#pragma once
+
+/**
+ * @file Trace.hpp
+ * @brief Trace scopes for widget hot paths, routed to LVGL's profiler
+ *
+ * OC_UI_TRACE_SCOPE("tag") emits a begin/end pair through
+ * LV_PROFILER_BEGIN_TAG / LV_PROFILER_END_TAG, so widget code shows up in
+ * the same trace as LVGL's own refresh, layout and draw events. Compiles to
+ * nothing when LV_USE_PROFILER is 0 (the default).
+ *
+ * Tags must be string literals (the builtin profiler stores the pointer).
+ *
+ * Usage:
+ * @code
+ * void KnobWidget::updateArc() {
+ *     OC_UI_TRACE_SCOPE("KnobWidget::updateArc");
+ *     ...
+ * }
+ * @endcode
+ */
+
+#include <lvgl.h>
+
+#if LV_USE_PROFILER
+
+namespace oc::ui::lvgl {
+
+class TraceScope {
+public:
+    explicit TraceScope(const char* tag) : tag_(tag) { LV_PROFILER_BEGIN_TAG(tag_); }
+    ~TraceScope() { LV_PROFILER_END_TAG(tag_); }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* tag_;
+};
+
+}  // namespace oc::ui::lvgl
+
+#define OC_UI_TRACE_CONCAT_INNER(a, b) a##b
+#define OC_UI_TRACE_CONCAT(a, b) OC_UI_TRACE_CONCAT_INNER(a, b)
+#define OC_UI_TRACE_SCOPE(tag) \
+    ::oc::ui::lvgl::TraceScope OC_UI_TRACE_CONCAT(oc_ui_trace_scope_, __LINE__)(tag)
+
+#else
+
+#define OC_UI_TRACE_SCOPE(tag) ((void)0)
+
+#endif
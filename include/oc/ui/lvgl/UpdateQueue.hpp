@@ -0,0 +1,184 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include <lvgl.h>
+
+namespace oc::ui::lvgl {
+
+class ButtonWidget;
+class EnumWidget;
+class KnobWidget;
+class Label;
+class StateIndicator;
+
+/**
+ * @brief Bounded lock-free queue of widget updates from non-LVGL threads
+ *
+ * MIDI, control or network threads must not call widget setters (see
+ * Lock.hpp). Instead they push small POD commands (target handle, op,
+ * payload) here; the LVGL thread drains them and calls the setters.
+ *
+ * - Producers: any number of threads (MPSC), never block, never allocate.
+ *   A push fails (returns false, counted as rejected) when the queue is full.
+ * - Consumer: the LVGL thread. attach() drains from an lv_timer every
+ *   LV_DEF_REFR_PERIOD, whether or not the screen is being redrawn (LVGL
+ *   pauses the display refresh while nothing is invalidated);
+ *   alternatively call drain() right before lv_timer_handler().
+ * - Folding: per drain, only the last command for each (target, op) is
+ *   applied, so a 1 kHz controller costs one setValue() per frame.
+ *
+ * Targets are registered on the LVGL thread and referenced by handle, so
+ * a command for a removed widget is dropped instead of touching freed
+ * memory. remove() a widget before destroying or moving it.
+ *
+ * Usage:
+ * @code
+ * // LVGL thread
+ * static UpdateQueue updates;
+ * updates.attach();
+ * UpdateQueue::Handle cutoff = updates.add(cutoffKnob);
+ * UpdateQueue::Handle name = updates.add(presetLabel);
+ *
+ * // MIDI thread
+ * updates.setValue(cutoff, cc / 127.0f);
+ * updates.setText(name, "Warm Pad");
+ * @endcode
+ */
+class UpdateQueue {
+public:
+    static constexpr uint32_t CAPACITY = 256;    // Power of two
+    static constexpr uint32_t MAX_TARGETS = 128;
+    static constexpr uint32_t TEXT_MAX = 16;     // Including the terminator
+
+    /** @brief Registered target (0 = invalid) */
+    using Handle = uint32_t;
+
+    enum class Op : uint8_t {
+        SetValue,  ///< KnobWidget::setValue(value)
+        SetText,   ///< Label / ButtonWidget ::setText(text)
+        SetState,  ///< ButtonWidget::setState(state != 0), StateIndicator::setState(state)
+        Flash,     ///< EnumWidget::triggerFlash()
+        COUNT
+    };
+
+    /**
+     * @brief One queued update (trivially copyable, 24 bytes)
+     */
+    struct Command {
+        Handle target = 0;
+        Op op = Op::SetValue;
+        union {
+            float value;
+            int32_t state;
+            char text[TEXT_MAX];
+        };
+
+        Command() : text{} {}
+    };
+
+    /** @brief Custom target: applies a command to ctx on the LVGL thread */
+    using ApplyFn = void (*)(void* ctx, const Command& command);
+
+    /**
+     * @brief Counters (rejected is updated by producers, the rest on drain)
+     */
+    struct Stats {
+        uint32_t pushed = 0;    ///< Accepted by push()
+        uint32_t rejected = 0;  ///< push() on a full queue
+        uint32_t applied = 0;   ///< Setter calls made
+        uint32_t folded = 0;    ///< Superseded by a later command in the same drain
+        uint32_t stale = 0;     ///< Removed target or op it doesn't support
+    };
+
+    UpdateQueue();
+    ~UpdateQueue();
+
+    UpdateQueue(const UpdateQueue&) = delete;
+    UpdateQueue& operator=(const UpdateQueue&) = delete;
+
+    // =========================================================================
+    // Producers (any thread, lock-free)
+    // =========================================================================
+
+    bool push(const Command& command);
+    bool setValue(Handle target, float value);
+    bool setText(Handle target, const char* text);  ///< Truncated to TEXT_MAX - 1
+    bool setState(Handle target, int32_t state);
+    bool flash(Handle target);
+
+    // =========================================================================
+    // LVGL thread
+    // =========================================================================
+
+    /** @return 0 when MAX_TARGETS are registered */
+    Handle add(KnobWidget& knob);
+    Handle add(Label& label);
+    Handle add(ButtonWidget& button);
+    Handle add(StateIndicator& indicator);
+    Handle add(EnumWidget& enumWidget);
+    Handle add(void* ctx, ApplyFn apply);
+
+    /** @brief Unregister; queued commands for the handle are dropped */
+    void remove(Handle target);
+
+    /**
+     * @brief Drain from an lv_timer every LV_DEF_REFR_PERIOD
+     *
+     * Call after the display is created: LVGL runs newer timers first, so
+     * commands are applied before that cycle's refresh.
+     */
+    void attach();
+    void detach();
+
+    /**
+     * @brief Apply pending commands, folded per (target, op)
+     *
+     * Drains at most CAPACITY commands so producers can't stall the UI.
+     * @return Number of setter calls made
+     */
+    uint32_t drain();
+
+    Stats stats() const;
+
+private:
+    enum class Kind : uint8_t { Free, Knob, Label, Button, Indicator, Enum, Custom };
+
+    struct Cell {
+        std::atomic<uint32_t> sequence{0};
+        Command command;
+    };
+
+    struct Target {
+        Kind kind = Kind::Free;
+        uint16_t generation = 0;
+        void* ptr = nullptr;
+        ApplyFn apply = nullptr;
+        uint16_t last[static_cast<int>(Op::COUNT)] = {};  // Drain index of the winning command
+    };
+
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+    static_assert(CAPACITY <= 0xFFFF, "Drain indices are 16-bit");
+
+    static void drainTimerCallback(lv_timer_t* timer);
+
+    Handle addTarget(Kind kind, void* ptr, ApplyFn apply);
+    Target* resolve(Handle handle);
+    bool pop(Command& out);
+    bool apply(const Target& target, const Command& command);
+
+    std::array<Cell, CAPACITY> cells_;
+    std::atomic<uint32_t> enqueue_pos_{0};
+    std::atomic<uint32_t> rejected_{0};
+
+    // Consumer only
+    uint32_t dequeue_pos_ = 0;
+    std::array<Command, CAPACITY> scratch_;
+    std::array<Target, MAX_TARGETS> targets_;
+    lv_timer_t* drain_timer_ = nullptr;
+    Stats stats_;
+};
+
+}  // namespace oc::ui::lvgl
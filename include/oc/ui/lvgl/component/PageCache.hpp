@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <lvgl.h>
+
+#include <oc/ui/lvgl/IComponent.hpp>
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief LRU cache of built pages (screens) under an lv_mem budget
+ *
+ * Each page type registers a builder and, optionally, a saver. show()
+ * hides the current page and shows the requested one: a cached page is
+ * just unhidden (hit); otherwise it is built (miss). After every show()
+ * the cache evicts least-recently-used hidden pages while LVGL's heap
+ * usage is above the budget. An evicted page first saves a compact state
+ * snapshot (scroll position, selected item, ...), which the builder gets
+ * back when the page is rebuilt.
+ *
+ * Heap usage comes from lv_mem_monitor() (total - free), which is exact
+ * with LV_STDLIB_BUILTIN; other allocators can provide a probe. Build
+ * times are measured with lv_tick (ms) unless a microsecond clock is set.
+ *
+ * Usage:
+ * @code
+ * PageCache pages(screen, 48 * 1024);
+ * pages.setClock(micros);
+ * pages.add(MIXER, [](lv_obj_t* parent, const PageCache::Snapshot& state) {
+ *     return std::make_unique<MixerPage>(parent, state);
+ * }, [](const IComponent& page, PageCache::Snapshot& state) {
+ *     static_cast<const MixerPage&>(page).save(state);
+ * });
+ * pages.show(MIXER);
+ * @endcode
+ */
+class PageCache {
+public:
+    using PageId = uint16_t;
+    using Snapshot = std::vector<uint8_t>;
+    using Builder = std::function<std::unique_ptr<IComponent>(lv_obj_t* parent, const Snapshot& state)>;
+    using Saver = std::function<void(const IComponent& page, Snapshot& state)>;
+    using MemoryProbe = size_t (*)();
+    using MicrosClock = uint32_t (*)();
+
+    struct Stats {
+        uint32_t hits = 0;        ///< show() of a cached page
+        uint32_t misses = 0;      ///< show() that had to build
+        uint32_t rebuilds = 0;    ///< ... of a page evicted before
+        uint32_t evictions = 0;   ///< Pages destroyed to meet the budget
+        uint32_t last_build_us = 0;
+        uint32_t max_build_us = 0;
+        uint64_t total_build_us = 0;
+    };
+
+    /**
+     * @param parent Parent of every page
+     * @param budgetBytes LVGL heap usage above which hidden pages are evicted
+     */
+    PageCache(lv_obj_t* parent, size_t budgetBytes);
+    ~PageCache();
+
+    PageCache(const PageCache&) = delete;
+    PageCache& operator=(const PageCache&) = delete;
+
+    /** @brief Register a page type (replaces an existing registration) */
+    void add(PageId id, Builder build, Saver save = nullptr);
+
+    /** @brief Show a page, building it if needed; nullptr if unknown or build failed */
+    IComponent* show(PageId id);
+
+    /** @brief Evict LRU hidden pages until usage <= budget; returns count */
+    size_t trim();
+
+    /** @brief Save and destroy every hidden page */
+    void clear();
+
+    void setBudget(size_t budgetBytes) { budget_ = budgetBytes; }
+    void setMemoryProbe(MemoryProbe probe) { probe_ = probe; }
+    void setClock(MicrosClock clock) { clock_ = clock; }
+
+    IComponent* current() const;
+    bool isCached(PageId id) const;
+    size_t cachedCount() const;
+    size_t usedBytes() const;
+    const Stats& stats() const { return stats_; }
+
+private:
+    struct Entry {
+        PageId id = 0;
+        Builder build;
+        Saver save;
+        std::unique_ptr<IComponent> page;
+        Snapshot state;
+        uint32_t last_used = 0;  // Use counter, higher = more recent
+        bool evicted = false;    // Built before, next build is a rebuild
+    };
+
+    Entry* find(PageId id);
+    const Entry* find(PageId id) const;
+    void evict(Entry& entry);
+    uint32_t nowUs() const;
+
+    lv_obj_t* parent_;
+    size_t budget_;
+    MemoryProbe probe_ = nullptr;
+    MicrosClock clock_ = nullptr;
+    std::vector<Entry> entries_;
+    PageId current_ = 0;
+    bool has_current_ = false;
+    uint32_t use_counter_ = 0;
+    Stats stats_;
+};
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <lvgl.h>
+
+namespace oc::ui::lvgl {
+
+class Label;
+class ParameterEnum;
+class ParameterKnob;
+class ParameterSwitch;
+
+/**
+ * @brief Maps framework parameter IDs to components, updated once per frame
+ *
+ * The framework reports parameter changes by ID (0..capacity-1) at
+ * whatever rate they happen. setValue() / setRibbon() / setText() only
+ * store the new state and set the parameter's bit in a packed dirty
+ * bitset; sweep() then visits the set bits only and calls each bound
+ * component's setters once. A thousand changes to the same knob between
+ * two frames cost one setValue(); changes to unbound parameters are stored
+ * (applied when bound) and never reach the sweep.
+ *
+ * Bound components:
+ * - ParameterKnob: value -> knob, ribbon -> knob ribbon, text -> optional
+ *   value label
+ * - ParameterEnum: text (or formatted value) -> value label + flash
+ * - ParameterSwitch: value >= 0.5 -> button state, text -> button text
+ *
+ * LVGL thread only; feed it from other threads through UpdateQueue (a
+ * custom target calling setValue()). unbind() a component before
+ * destroying or moving it.
+ *
+ * Usage:
+ * @code
+ * ParameterBindings bindings(4096);
+ * bindings.bind(CUTOFF, cutoffKnob, &cutoffValueLabel);
+ * bindings.format(CUTOFF, [](float v, char* out, size_t size) {
+ *     lv_snprintf(out, size, "%d%%", static_cast<int>(v * 100.0f));
+ * });
+ * bindings.attach();                          // sweep once per refresh period
+ *
+ * bindings.setValue(CUTOFF, 0.42f);           // any number of times per frame
+ * @endcode
+ */
+class ParameterBindings {
+public:
+    using ParameterId = uint32_t;
+    using Formatter = void (*)(float value, char* out, size_t size);
+
+    static constexpr size_t TEXT_MAX = 24;  // Including the terminator
+
+    struct Stats {
+        uint32_t sets = 0;     ///< setValue/setRibbon/setText calls
+        uint32_t marked = 0;   ///< ... that set a clean bit (bound, changed)
+        uint32_t applied = 0;  ///< Components updated by sweep()
+    };
+
+    explicit ParameterBindings(uint32_t capacity);
+    ~ParameterBindings();
+
+    ParameterBindings(const ParameterBindings&) = delete;
+    ParameterBindings& operator=(const ParameterBindings&) = delete;
+
+    // =========================================================================
+    // Bindings (one component per parameter, rebinding replaces it)
+    // =========================================================================
+
+    bool bind(ParameterId id, ParameterKnob& knob, Label* valueLabel = nullptr);
+    bool bind(ParameterId id, ParameterEnum& param);
+    bool bind(ParameterId id, ParameterSwitch& param);
+    void unbind(ParameterId id);
+
+    /** @brief Value -> text for the value label (when no text is set) */
+    bool format(ParameterId id, Formatter formatter);
+
+    // =========================================================================
+    // Parameter changes
+    // =========================================================================
+
+    /** @return true if the parameter is bound and the value changed */
+    bool setValue(ParameterId id, float value);
+    bool setRibbon(ParameterId id, float value);
+    bool setText(ParameterId id, const char* text);  ///< Truncated to TEXT_MAX - 1
+
+    float value(ParameterId id) const { return id < capacity_ ? params_[id].value : 0.0f; }
+
+    // =========================================================================
+    // Per-frame sweep
+    // =========================================================================
+
+    /**
+     * @brief Sweep from an lv_timer every LV_DEF_REFR_PERIOD
+     *
+     * Runs while the display refresh is paused too (an idle screen), and
+     * before that cycle's refresh when attached after the display is created.
+     */
+    void attach();
+    void detach();
+
+    /** @return Number of components updated */
+    uint32_t sweep();
+
+    uint32_t capacity() const { return capacity_; }
+    const Stats& stats() const { return stats_; }
+    void resetStats() { stats_ = Stats{}; }
+
+private:
+    enum class Kind : uint8_t { Knob, Enum, Switch };
+
+    enum Field : uint8_t {
+        FIELD_VALUE = 1 << 0,
+        FIELD_RIBBON = 1 << 1,
+        FIELD_TEXT = 1 << 2
+    };
+
+    struct Param {
+        float value = 0.0f;
+        float ribbon = 0.0f;
+        uint16_t binding = 0;  // Index + 1 into bindings_, 0 = unbound
+        uint8_t changed = 0;   // Field mask, valid while the dirty bit is set
+        bool ribbon_set = false;
+    };
+
+    struct Binding {
+        Kind kind = Kind::Knob;
+        void* component = nullptr;  // nullptr = free slot
+        Label* value_label = nullptr;
+        Formatter formatter = nullptr;
+        bool has_text = false;
+        char text[TEXT_MAX] = {};
+    };
+
+    static void sweepTimerCallback(lv_timer_t* timer);
+
+    bool bindComponent(ParameterId id, Kind kind, void* component, Label* valueLabel);
+    bool mark(ParameterId id, uint8_t field);
+    void apply(const Param& param, Binding& binding, uint8_t changed);
+    const char* valueText(const Param& param, Binding& binding, char* buf);
+
+    uint32_t capacity_;
+    std::vector<Param> params_;
+    std::vector<uint32_t> dirty_;  // One bit per parameter
+    std::vector<Binding> bindings_;
+    lv_timer_t* sweep_timer_ = nullptr;
+    Stats stats_;
+};
+
+}  // namespace oc::ui::lvgl
@@ -1,10 +1,11 @@
 #pragma once
 
-#include <memory>
+#include <optional>
 
 #include <lvgl.h>
 
 #include <oc/ui/lvgl/IComponent.hpp>
+#include <oc/ui/lvgl/ObjectTree.hpp>
 
 #include "../widget/EnumWidget.hpp"
 #include "../widget/Label.hpp"
@@ -21,6 +22,9 @@ namespace oc::ui::lvgl {
  *
  * Access inner widgets directly for configuration.
  *
+ * ObjectTree::Lean builds a flex column, a lean EnumWidget and lean
+ * Labels: 5 objects instead of 8.
+ *
  * Usage:
  * @code
  * auto param = ParameterEnum(parent);
@@ -31,7 +35,7 @@ namespace oc::ui::lvgl {
  */
 class ParameterEnum : public IComponent {
 public:
-    explicit ParameterEnum(lv_obj_t* parent);
+    explicit ParameterEnum(lv_obj_t* parent, ObjectTree tree = ObjectTree::Standard);
     ~ParameterEnum();
 
     // Move only
@@ -55,13 +59,14 @@ public:
     const Label& nameLabel() const { return *name_label_; }
 
 private:
-    void createUI(lv_obj_t* parent);
+    void createUI(lv_obj_t* parent, ObjectTree tree);
     void cleanup();
 
     lv_obj_t* container_ = nullptr;
-    std::unique_ptr<EnumWidget> enum_widget_;
-    std::unique_ptr<Label> value_label_;
-    std::unique_ptr<Label> name_label_;
+    // Embedded (no heap), constructed by createUI()
+    std::optional<EnumWidget> enum_widget_;
+    std::optional<Label> value_label_;
+    std::optional<Label> name_label_;
 };
 
 }  // namespace oc::ui::lvgl
@@ -1,10 +1,11 @@
 #pragma once
 
-#include <memory>
+#include <optional>
 
 #include <lvgl.h>
 
 #include <oc/ui/lvgl/IComponent.hpp>
+#include <oc/ui/lvgl/ObjectTree.hpp>
 
 #include "../widget/KnobWidget.hpp"
 #include "../widget/Label.hpp"
@@ -21,6 +22,9 @@ namespace oc::ui::lvgl {
  *
  * Access inner widgets directly for configuration.
  *
+ * ObjectTree::Lean replaces the grid with a flex column (same placement)
+ * and uses a lean Label: one object less, no grid track resolution.
+ *
  * Usage:
  * @code
  * auto param = ParameterKnob(parent);
@@ -30,7 +34,7 @@ namespace oc::ui::lvgl {
  */
 class ParameterKnob : public IComponent {
 public:
-    explicit ParameterKnob(lv_obj_t* parent);
+    explicit ParameterKnob(lv_obj_t* parent, ObjectTree tree = ObjectTree::Standard);
     ~ParameterKnob();
 
     // Move only
@@ -52,12 +56,13 @@ public:
     const Label& label() const { return *label_; }
 
 private:
-    void createUI(lv_obj_t* parent);
+    void createUI(lv_obj_t* parent, ObjectTree tree);
     void cleanup();
 
     lv_obj_t* container_ = nullptr;
-    std::unique_ptr<KnobWidget> knob_;
-    std::unique_ptr<Label> label_;
+    // Embedded (no heap), constructed by createUI()
+    std::optional<KnobWidget> knob_;
+    std::optional<Label> label_;
 };
 
 }  // namespace oc::ui::lvgl
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <lvgl.h>
+
+#include "ParameterEnum.hpp"
+#include "ParameterKnob.hpp"
+#include "ParameterSwitch.hpp"
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief Component type shown in a ParameterPage slot
+ */
+enum class ParameterType : uint8_t { None, Knob, Enum, Switch };
+
+/**
+ * @brief Descriptor of one page slot (strings are copied by the widgets)
+ */
+struct ParameterSlot {
+    ParameterType type = ParameterType::None;
+    const char* name = "";
+    uint32_t color = 0;            ///< Track / line / on color (0 = theme default)
+    bool centered = false;         ///< Knob only (bipolar parameter)
+    float value = 0.0f;            ///< Knob value, switch state (>= 0.5 = on)
+    const char* valueText = "";    ///< Enum value label, switch text
+};
+
+/**
+ * @brief Fixed grid of recycled parameter components for bank switching
+ *
+ * Switching a remote-control page normally destroys and recreates every
+ * component (containers, grids, children, timers). ParameterPage keeps the
+ * instances: setPage() diffs each slot against what its component shows
+ * and only touches what differs. Name, value and texts are compared with
+ * the live widgets, so edits made through knob() / enumParam() /
+ * switchParam() are undone by the next setPage(); color and the centered
+ * flag are compared with the previous descriptor, so set them through
+ * setPage() only. Slots whose type changes return their component to a per-type
+ * pool of hidden spares and take one from the new type's pool, so after
+ * the first few pages no LVGL object is created or deleted.
+ *
+ * Values set by setPage() don't flash: the knob shows a different
+ * parameter, it didn't change.
+ *
+ * Components are built with the page's ObjectTree (ObjectTree::Lean for
+ * fewer objects per slot).
+ *
+ * Usage:
+ * @code
+ * ParameterPage page(parent, 4, 2);
+ * ParameterSlot bank[8] = {
+ *     {ParameterType::Knob, "Cutoff", 0xFCEB23, false, 0.42f},
+ *     {ParameterType::Enum, "Wave", 0, false, 0.0f, "Saw"},
+ *     ...
+ * };
+ * page.setPage(bank, 8);
+ * page.knob(0)->knob().setValue(0.5f);  // Live updates, flashing
+ * @endcode
+ */
+class ParameterPage {
+public:
+    ParameterPage(lv_obj_t* parent, uint8_t cols = 4, uint8_t rows = 2,
+                  ObjectTree tree = ObjectTree::Standard);
+    ~ParameterPage();
+
+    ParameterPage(const ParameterPage&) = delete;
+    ParameterPage& operator=(const ParameterPage&) = delete;
+
+    lv_obj_t* getElement() const { return container_; }
+    size_t slotCount() const { return slots_.size(); }
+
+    /**
+     * @brief Show a page; slots beyond count are emptied
+     * @return Number of slots that needed any update
+     */
+    size_t setPage(const ParameterSlot* slots, size_t count);
+
+    /** @brief Component currently in a slot (nullptr if another type) */
+    ParameterKnob* knob(size_t slot) const;
+    ParameterEnum* enumParam(size_t slot) const;
+    ParameterSwitch* switchParam(size_t slot) const;
+
+private:
+    template <typename T>
+    struct Pool {
+        std::vector<std::unique_ptr<T>> all;
+        std::vector<T*> spare;
+    };
+
+    struct Slot {
+        ParameterType type = ParameterType::None;
+        void* component = nullptr;
+        uint32_t color = 0;     // Configuration of the last setPage()
+        bool centered = false;
+    };
+
+    template <typename T>
+    T* acquire(Pool<T>& pool, size_t index);
+    template <typename T>
+    void release(Pool<T>& pool, T* component);
+
+    void swapType(Slot& slot, size_t index, ParameterType type);
+    bool update(Slot& slot, const ParameterSlot& desc, bool fresh);
+
+    lv_obj_t* container_ = nullptr;
+    uint8_t cols_;
+    uint8_t rows_;
+    ObjectTree tree_;
+    std::vector<int32_t> col_dsc_;
+    std::vector<int32_t> row_dsc_;
+    std::vector<Slot> slots_;
+
+    Pool<ParameterKnob> knobs_;
+    Pool<ParameterEnum> enums_;
+    Pool<ParameterSwitch> switches_;
+};
+
+}  // namespace oc::ui::lvgl
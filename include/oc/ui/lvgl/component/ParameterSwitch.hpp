@@ -1,10 +1,11 @@
 #pragma once
 
-#include <memory>
+#include <optional>
 
 #include <lvgl.h>
 
 #include <oc/ui/lvgl/IComponent.hpp>
+#include <oc/ui/lvgl/ObjectTree.hpp>
 
 #include "../widget/ButtonWidget.hpp"
 #include "../widget/Label.hpp"
@@ -21,6 +22,9 @@ namespace oc::ui::lvgl {
  *
  * Access inner widgets directly for configuration.
  *
+ * ObjectTree::Lean replaces the grid with a flex column (button grows
+ * into the remaining height, centered) and uses a lean Label.
+ *
  * Usage:
  * @code
  * auto param = ParameterSwitch(parent);
@@ -30,7 +34,7 @@ namespace oc::ui::lvgl {
  */
 class ParameterSwitch : public IComponent {
 public:
-    explicit ParameterSwitch(lv_obj_t* parent);
+    explicit ParameterSwitch(lv_obj_t* parent, ObjectTree tree = ObjectTree::Standard);
     ~ParameterSwitch();
 
     // Move only
@@ -52,12 +56,13 @@ public:
     const Label& label() const { return *label_; }
 
 private:
-    void createUI(lv_obj_t* parent);
+    void createUI(lv_obj_t* parent, ObjectTree tree);
     void cleanup();
 
     lv_obj_t* container_ = nullptr;
-    std::unique_ptr<ButtonWidget> button_;
-    std::unique_ptr<Label> label_;
+    // Embedded (no heap), constructed by createUI()
+    std::optional<ButtonWidget> button_;
+    std::optional<Label> label_;
 };
 
 }  // namespace oc::ui::lvgl
@@ -6,6 +6,7 @@
 
 #include <oc/ui/lvgl/IWidget.hpp>
 #include <oc/ui/lvgl/SquareSizePolicy.hpp>
+#include <oc/ui/lvgl/StaticAlloc.hpp>
 
 #include "../theme/BaseTheme.hpp"
 
@@ -17,6 +18,9 @@ namespace oc::ui::lvgl {
  * Provides a button with customizable colors for each state.
  * Content can be added to inner() or use setText() for simple text.
  *
+ * Like KnobWidget, this is its own LVGL object class: state lives in the
+ * object and ButtonWidget is a one-pointer handle that is safe to move.
+ *
  * Usage:
  * @code
  * ButtonWidget button(parent);
@@ -40,11 +44,11 @@ public:
     ButtonWidget& operator=(const ButtonWidget&) = delete;
 
     // LVGL Access
-    lv_obj_t* getElement() const override { return container_; }
-    operator lv_obj_t*() const { return container_; }
+    lv_obj_t* getElement() const override { return obj_; }
+    operator lv_obj_t*() const { return obj_; }
 
     /** @brief Parent object for adding custom content */
-    lv_obj_t* inner() const { return button_box_; }
+    lv_obj_t* inner() const;
 
     // Fluent Configuration
     ButtonWidget& offColor(uint32_t color);      ///< Background when OFF
@@ -56,43 +60,19 @@ public:
 
     // State
     void setState(bool on);
-    bool getState() const { return is_on_; }
+    bool getState() const;
 
     /** @brief Set text (creates internal label if needed) */
     void setText(const char* text);
 
-private:
-    // Sizing constants
-    static constexpr float DEFAULT_PADDING_RATIO = 0.25f;  // 25% padding each side = 50% total, button = 50% of container
-    static constexpr float RADIUS_RATIO = 0.15f;           // Corner radius relative to button size
-    static constexpr lv_coord_t MIN_SIZE = 20;             // Minimum button size
-
-    void createUI();
-    void cleanup();
-    void applyState();
-    void updateGeometry();
-    static void sizeChangedCallback(lv_event_t* e);
-
-    // LVGL objects
-    lv_obj_t* container_ = nullptr;
-    lv_obj_t* button_box_ = nullptr;
-    lv_obj_t* state_label_ = nullptr;  // Created by setText(), nullptr otherwise
+    /** @brief Text shown ("" before setText()) */
+    const char* getText() const;
 
-    // Cached size
-    lv_coord_t button_size_ = 0;
+    /** @brief LVGL class of button objects (e.g. for lv_obj_check_type) */
+    static const lv_obj_class_t* objClass();
 
-    // State
-    bool is_on_ = false;
-
-    // Configuration
-    uint32_t off_color_ = 0;
-    uint32_t on_color_ = 0;
-    uint32_t text_off_color_ = 0;
-    uint32_t text_on_color_ = 0;
-    float padding_ratio_ = DEFAULT_PADDING_RATIO;
-
-    // Size policy
-    SquareSizePolicy size_policy_;
+private:
+    lv_obj_t* obj_ = nullptr;  // Button object, holds all widget state
 };
 
 }  // namespace oc::ui::lvgl
@@ -5,7 +5,9 @@
 #include <lvgl.h>
 
 #include <oc/ui/lvgl/IWidget.hpp>
+#include <oc/ui/lvgl/ObjectTree.hpp>
 #include <oc/ui/lvgl/SquareSizePolicy.hpp>
+#include <oc/ui/lvgl/StaticAlloc.hpp>
 
 #include "../theme/BaseTheme.hpp"
 
@@ -17,6 +19,12 @@ namespace oc::ui::lvgl {
  * Provides a container with a horizontal indicator line at the top
  * that can flash on value changes. Content is added to inner().
  *
+ * Like KnobWidget, this is its own LVGL object class: state lives in the
+ * object and EnumWidget is a one-pointer handle that is safe to move.
+ *
+ * With ObjectTree::Lean the widget object itself is the flex column
+ * holding the line and the content (inner() == getElement()).
+ *
  * Usage:
  * @code
  * EnumWidget widget(parent);
@@ -31,7 +39,7 @@ namespace oc::ui::lvgl {
  */
 class EnumWidget : public IWidget {
 public:
-    explicit EnumWidget(lv_obj_t* parent);
+    explicit EnumWidget(lv_obj_t* parent, ObjectTree tree = ObjectTree::Standard);
     ~EnumWidget();
 
     // Move only
@@ -41,11 +49,11 @@ public:
     EnumWidget& operator=(const EnumWidget&) = delete;
 
     // LVGL Access
-    lv_obj_t* getElement() const override { return container_; }
-    operator lv_obj_t*() const { return container_; }
+    lv_obj_t* getElement() const override { return obj_; }
+    operator lv_obj_t*() const { return obj_; }
 
     /** @brief Parent object for adding content */
-    lv_obj_t* inner() const { return inner_; }
+    lv_obj_t* inner() const;
 
     // Fluent Configuration
     /** @brief Background color of container */
@@ -67,34 +75,11 @@ public:
     /** @brief Trigger a flash animation on the indicator line */
     void triggerFlash();
 
+    /** @brief LVGL class of enum widget objects (e.g. for lv_obj_check_type) */
+    static const lv_obj_class_t* objClass();
+
 private:
-    static constexpr uint16_t DEFAULT_WIDTH = 62;
-    static constexpr lv_coord_t LINE_HEIGHT = 2;
-    static constexpr lv_coord_t LINE_MARGIN = 4;
-    static constexpr lv_coord_t LINE_TOP_MARGIN = 2;
-    static constexpr lv_coord_t LINE_BOTTOM_MARGIN = 2;
-    static constexpr lv_coord_t INNER_HEIGHT = 40;
-
-    void createUI();
-    void cleanup();
-    void applyColors();
-    void updateGeometry();
-    static void flashTimerCallback(lv_timer_t* timer);
-    static void sizeChangedCallback(lv_event_t* e);
-
-    // LVGL objects
-    lv_obj_t* container_ = nullptr;
-    lv_obj_t* inner_ = nullptr;
-    lv_obj_t* top_line_ = nullptr;
-    lv_timer_t* flash_timer_ = nullptr;
-
-    // Configuration
-    uint32_t bg_color_ = 0;
-    uint32_t line_color_ = 0;
-    uint32_t flash_color_ = 0;
-
-    // Size policy
-    SquareSizePolicy size_policy_;
+    lv_obj_t* obj_ = nullptr;  // Widget object, holds all widget state
 };
 
 }  // namespace oc::ui::lvgl
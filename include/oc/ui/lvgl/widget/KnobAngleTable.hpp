@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief Precomputed angle lookup for the knob sweep
+ *
+ * The knob arc covers 270° starting at 135° (7 o'clock, LVGL angles grow
+ * clockwise). Values are quantized to STEPS_PER_DEGREE steps per degree and
+ * cos/sin for every step are computed at compile time, so value updates
+ * never call into libm.
+ *
+ * Usage:
+ * @code
+ * uint16_t idx = knob_angle::index(0.5f);
+ * float x = cx + r * knob_angle::cosAt(idx);
+ * float y = cy + r * knob_angle::sinAt(idx);
+ * int16_t deg = knob_angle::degrees(idx);
+ * @endcode
+ */
+namespace knob_angle {
+
+constexpr int16_t START_DEGREES = 135;
+constexpr int16_t SWEEP_DEGREES = 270;
+constexpr int16_t END_DEGREES = (START_DEGREES + SWEEP_DEGREES) % 360;  // 45° (wraps)
+constexpr uint16_t STEPS_PER_DEGREE = 4;                          // 0.25° resolution
+constexpr uint16_t STEP_COUNT = SWEEP_DEGREES * STEPS_PER_DEGREE;  // Last valid index
+
+struct Entry {
+    float cos;
+    float sin;
+};
+
+namespace detail {
+
+constexpr double PI = 3.14159265358979323846;
+
+// Taylor series, argument reduced to [-PI, PI] by the caller
+constexpr double sinSeries(double x) {
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 14; ++n) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double reduce(double rad) {
+    while (rad > PI) rad -= 2.0 * PI;
+    while (rad < -PI) rad += 2.0 * PI;
+    return rad;
+}
+
+constexpr std::array<Entry, STEP_COUNT + 1> buildTable() {
+    std::array<Entry, STEP_COUNT + 1> table{};
+    for (uint16_t i = 0; i <= STEP_COUNT; ++i) {
+        double deg = START_DEGREES + static_cast<double>(i) / STEPS_PER_DEGREE;
+        double rad = deg * PI / 180.0;
+        table[i].sin = static_cast<float>(sinSeries(reduce(rad)));
+        table[i].cos = static_cast<float>(sinSeries(reduce(rad + PI / 2.0)));
+    }
+    return table;
+}
+
+}  // namespace detail
+
+inline constexpr std::array<Entry, STEP_COUNT + 1> TABLE = detail::buildTable();
+
+/**
+ * @brief Quantize a normalized value (0.0-1.0) to a table index
+ */
+constexpr uint16_t index(float normalized) {
+    if (normalized <= 0.0f) return 0;
+    if (normalized >= 1.0f) return STEP_COUNT;
+    return static_cast<uint16_t>(normalized * STEP_COUNT + 0.5f);
+}
+
+/**
+ * @brief Integer LVGL angle (degrees, truncated) for a table index
+ */
+constexpr int16_t degrees(uint16_t idx) {
+    return static_cast<int16_t>(START_DEGREES + idx / STEPS_PER_DEGREE);
+}
+
+constexpr float cosAt(uint16_t idx) { return TABLE[idx].cos; }
+constexpr float sinAt(uint16_t idx) { return TABLE[idx].sin; }
+
+}  // namespace knob_angle
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <lvgl.h>
+
+#include "KnobWidget.hpp"
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief Group of knobs updated together, with their values in flat arrays
+ *
+ * For mixer and modulation views where dozens of knobs change every frame.
+ * setValue() / setOrigin() / setRibbonValue() only store into contiguous
+ * arrays. commit() then clamps and quantizes every knob in one branch-free
+ * pass over those arrays (vectorizable) and compares the angle indices with
+ * the last committed ones. Only knobs whose indices changed are applied,
+ * through an internal KnobWidget entry point that takes those indices: no
+ * second clamp, epsilon test or angle lookup, and one hidden-ancestor check
+ * per knob instead of one per setter.
+ *
+ * The bank owns its knobs. Configure them (colors, size mode, ...) through
+ * knob(i), but drive origin, value and ribbon through the bank so its
+ * arrays stay in sync: don't call centered(), origin(), setValue() or
+ * setRibbonValue() through knob(i), use setCentered() and the setters
+ * below. Like a std::vector, add() invalidates references to earlier knobs
+ * (the LVGL objects themselves never move).
+ *
+ * Usage:
+ * @code
+ * KnobBank bank;
+ * bank.reserve(64);
+ * for (int i = 0; i < 64; i++) {
+ *     bank.add(grid).trackColor(base_theme::color::getMacroColor(i % 8));
+ * }
+ *
+ * // Once per frame
+ * bank.setValues(automation, 64);
+ * bank.commit();
+ * @endcode
+ */
+class KnobBank {
+public:
+    KnobBank() = default;
+
+    // Move only
+    KnobBank(KnobBank&&) noexcept = default;
+    KnobBank& operator=(KnobBank&&) noexcept = default;
+    KnobBank(const KnobBank&) = delete;
+    KnobBank& operator=(const KnobBank&) = delete;
+
+    void reserve(size_t count);
+
+    /** @brief Create a knob at the next index */
+    KnobWidget& add(lv_obj_t* parent);
+
+    size_t size() const { return knobs_.size(); }
+    KnobWidget& knob(size_t i) { return knobs_[i]; }
+    const KnobWidget& knob(size_t i) const { return knobs_[i]; }
+
+    // Pending values (no LVGL calls, applied by commit())
+    void setValue(size_t i, float value) { values_[i] = value; }
+    void setValues(const float* values, size_t count, size_t first = 0);
+    void setOrigin(size_t i, float origin) { origins_[i] = origin; }
+    void setRibbonValue(size_t i, float value);  ///< Enables the knob's ribbon on commit
+    float getValue(size_t i) const { return values_[i]; }
+
+    /**
+     * @brief KnobWidget::centered() on knob i, applied at once
+     *
+     * Takes the knob's resulting origin and value (0.5 when centering a knob
+     * at origin 0) as the bank's, replacing pending ones.
+     */
+    void setCentered(size_t i, bool centered);
+
+    /**
+     * @brief Apply pending values to the knobs whose angles changed
+     * @param flash Flash the knobs whose value changed
+     * @return Number of knobs updated
+     */
+    size_t commit(bool flash = true);
+
+private:
+    static constexpr uint16_t RIBBON_OFF = 0xFFFF;  // Angle index of a knob without ribbon
+
+    std::vector<KnobWidget> knobs_;
+
+    // Model values, as set (unclamped)
+    std::vector<float> values_;
+    std::vector<float> origins_;
+    std::vector<float> ribbon_values_;
+    std::vector<uint8_t> ribbon_on_;
+
+    // Quantized angles (knob_angle indices) last pushed to each knob
+    std::vector<uint16_t> value_idx_;
+    std::vector<uint16_t> origin_idx_;
+    std::vector<uint16_t> ribbon_idx_;
+
+    // commit() scratch: per-knob change mask
+    std::vector<uint8_t> changed_;
+};
+
+}  // namespace oc::ui::lvgl
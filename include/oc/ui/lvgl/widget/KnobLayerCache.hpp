@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <lvgl.h>
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief Shared cache of pre-rendered static knob layers
+ *
+ * The background arc of a KnobWidget never changes on value updates. This
+ * cache renders it once per geometry and color combination into an
+ * ARGB8888 lv_draw_buf, shared by every knob with the same key. Buffers are reference counted and freed when the last
+ * knob releases them.
+ *
+ * Used internally by KnobWidget::staticLayerCache(true).
+ */
+class KnobLayerCache {
+public:
+    /**
+     * @brief Geometry + colors that fully determine the static layer
+     */
+    struct Key {
+        lv_coord_t size = 0;           ///< Square buffer size (knob size)
+        lv_coord_t arc_size = 0;       ///< Arc outer diameter
+        lv_coord_t arc_width = 0;      ///< Background arc thickness
+        bool square_caps = false;      ///< Arc without rounded ends (KnobLod::SquareCaps)
+        uint32_t bg_color = 0;         ///< Background arc
+
+        bool operator==(const Key& other) const {
+            return size == other.size && arc_size == other.arc_size && arc_width == other.arc_width &&
+                   square_caps == other.square_caps && bg_color == other.bg_color;
+        }
+        bool operator!=(const Key& other) const { return !(*this == other); }
+    };
+
+    /**
+     * @brief Get (rendering on first use) the layer for a key
+     * @param key Geometry and colors
+     * @param host Any object on the target display (used for the scratch canvas)
+     * @return Shared buffer usable as lv_image source, nullptr if unavailable
+     */
+    static lv_draw_buf_t* acquire(const Key& key, lv_obj_t* host);
+
+    /**
+     * @brief Release a buffer obtained from acquire()
+     *
+     * The buffer is destroyed when no knob references it anymore.
+     */
+    static void release(lv_draw_buf_t* buf);
+
+    /** @brief Number of distinct layers currently alive */
+    static size_t size() { return entries().size(); }
+
+private:
+    struct Entry {
+        Key key;
+        lv_draw_buf_t* buf = nullptr;
+        uint32_t refs = 0;
+    };
+
+    static std::vector<Entry>& entries();
+    static lv_draw_buf_t* render(const Key& key, lv_obj_t* host);
+};
+
+}  // namespace oc::ui::lvgl
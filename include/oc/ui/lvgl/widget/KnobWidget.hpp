@@ -6,11 +6,21 @@
 
 #include <oc/ui/lvgl/IWidget.hpp>
 #include <oc/ui/lvgl/SquareSizePolicy.hpp>
+#include <oc/ui/lvgl/StaticAlloc.hpp>
 
 #include "../theme/BaseTheme.hpp"
+#include "RibbonFeed.hpp"
 
 namespace oc::ui::lvgl {
 
+/** @brief Level of detail of a KnobWidget, chosen from its size (see lodThresholds()) */
+enum class KnobLod : uint8_t {
+    Full,           ///< Arc, ribbon, indicator, center and inner circles
+    NoInnerCircle,  ///< No inner circle, so no flash either
+    NoIndicator,    ///< ... no indicator line nor center circle (value shown by the arc)
+    SquareCaps      ///< ... arcs without rounded ends
+};
+
 /**
  * @brief Rotary knob widget with arc visualization
  *
@@ -18,6 +28,26 @@ namespace oc::ui::lvgl {
  * Supports normal and centered (bipolar) modes.
  * Pure visual widget - input handling is external.
  * Flashes inner circle on value change.
+ * Value changes only invalidate the swept arc band and the old/new
+ * indicator line, not the whole knob. The value is always stored, but a
+ * change moving the indicator tip by less than half a pixel from where it
+ * is drawn skips the redraw and the flash (moves to 0 or 1 always redraw).
+ *
+ * With staticLayerCache(true), the background arc is drawn from a
+ * pre-rendered image shared by all knobs of the same size and background
+ * color (see KnobLayerCache). The value arc, ribbon, indicator and center
+ * circles stay live objects in the same stacking order, so the knob looks
+ * identical in both modes.
+ *
+ * Modulation: after ribbonFeed(mode), pushRibbonSample() accepts samples at
+ * any rate from any thread. Once per frame they are reduced (latest value,
+ * min/max envelope or one-pole smoothing) and the ribbon redraws only if
+ * its quantized span changed.
+ *
+ * The knob is its own LVGL object class (objClass()): all state lives in
+ * the object's allocation and LVGL callbacks find it through the object.
+ * KnobWidget is a one-pointer handle that owns the object; moving it
+ * never invalidates anything LVGL holds.
  *
  * The widget adapts to its parent size:
  * - Takes 100% of parent width/height
@@ -25,6 +55,11 @@ namespace oc::ui::lvgl {
  * - Minimum size: 30px
  * - Centers the knob within the container
  *
+ * Small knobs switch to cheaper representations (KnobLod): below 40 px
+ * the inner flash circle is dropped, below 34 px the indicator line and
+ * center circle too. lodThresholds() changes the sizes per knob and can
+ * enable square arc caps, the last level.
+ *
  * Usage:
  * @code
  * KnobWidget knob(parent);
@@ -46,8 +81,8 @@ public:
     KnobWidget& operator=(const KnobWidget&) = delete;
 
     // LVGL Access
-    lv_obj_t* getElement() const override { return container_; }
-    operator lv_obj_t*() const { return container_; }
+    lv_obj_t* getElement() const override { return obj_; }
+    operator lv_obj_t*() const { return obj_; }
 
     // Fluent Configuration
     KnobWidget& centered(bool c);
@@ -61,86 +96,59 @@ public:
     KnobWidget& ribbonColor(uint32_t color);         ///< Ribbon arc color
     KnobWidget& ribbonOpacity(lv_opa_t opa);         ///< Ribbon opacity (default: LV_OPA_COVER)
     KnobWidget& ribbonThickness(float ratio);        ///< Thickness relative to main arc (0.0-1.0, default: 0.8)
+    KnobWidget& ribbonFeed(RibbonMode mode, uint32_t smoothing_ms = 60);  ///< Enable per-frame sample reduction
 
     // Size Policy
     KnobWidget& sizeMode(SizeMode mode);             ///< Set sizing mode (default: Auto)
 
+    // Rendering
+    KnobWidget& staticLayerCache(bool enabled);      ///< Draw the background arc from a shared image (default: false)
+
+    /**
+     * @brief Knob sizes (px) below which each KnobLod level applies; 0 = never
+     *
+     * Defaults: 40, 34, 0. Levels are cumulative, e.g. a knob below
+     * noIndicatorBelow has no inner circle either.
+     */
+    KnobWidget& lodThresholds(lv_coord_t noInnerBelow, lv_coord_t noIndicatorBelow, lv_coord_t squareCapsBelow);
+
     // Data
-    void setValue(float value);
-    float getValue() const { return value_; }
+    void setValue(float value, bool flash = true);  ///< flash = false: show a new parameter, not a change
+    float getValue() const;
+    float getOrigin() const;
+    KnobLod getLod() const;                          ///< Level for the current size
     void setRibbonValue(float value);                ///< Set ribbon position (auto-enables ribbon)
+    void setRibbonSpan(float from, float to);        ///< Ribbon between two values (independent of value)
     void setRibbonEnabled(bool enabled);             ///< Show/hide ribbon arc
+    void pushRibbonSample(float value);              ///< Thread-safe, lock-free; requires ribbonFeed()
     void setVisible(bool visible);
 
+    /** @brief LVGL class of knob objects (e.g. for lv_obj_check_type) */
+    static const lv_obj_class_t* objClass();
+
 private:
-    // Fixed proportions (relative to knob size)
-    static constexpr uint16_t MIN_SIZE = 30;
-    static constexpr uint32_t FLASH_RATE_LIMIT_MS = 80;    // Min interval between flashes
-    static constexpr float ARC_WIDTH_RATIO = 0.13f;        // Arc width as ratio of size
-    static constexpr float INDICATOR_RATIO = 0.13f;        // Indicator thickness ratio
-    static constexpr float CENTER_CIRCLE_RATIO = 0.22f;    // Center circle size ratio
-    static constexpr float INNER_CIRCLE_RATIO = 0.10f;     // Inner circle size ratio
-    static constexpr int16_t START_ANGLE = 135;
-    static constexpr int16_t END_ANGLE = 45;
-    static constexpr float ARC_SWEEP_DEGREES = 270.0f;
-
-    void createUI();
-    void createArc();
-    void createRibbon();
-    void createIndicator();
-    void createCenterCircles();
-    void applyColors();
-    void applyRibbonColors();
-    void updateGeometry();
-    void updateArc();
-    void updateRibbon();
-    void updateIndicatorLine(float angleRad);
-    void triggerFlash();
-    static void flashTimerCallback(lv_timer_t* timer);
-    static void sizeChangedCallback(lv_event_t* e);
-    float normalizedToAngle(float normalized) const;
-    void cleanup();
-
-    // LVGL objects
-    lv_obj_t* container_ = nullptr;
-    lv_obj_t* arc_ = nullptr;
-    lv_obj_t* ribbon_arc_ = nullptr;
-    lv_obj_t* indicator_ = nullptr;
-    lv_obj_t* center_circle_ = nullptr;
-    lv_obj_t* inner_circle_ = nullptr;
-    lv_timer_t* flash_timer_ = nullptr;
-
-    // Indicator line points
-    lv_point_precise_t line_points_[2];
-
-    // Configuration
-    uint32_t bg_color_ = 0;
-    uint32_t track_color_ = 0;
-    uint32_t value_color_ = 0;
-    uint32_t flash_color_ = 0;
-
-    // Ribbon configuration
-    uint32_t ribbon_color_ = 0;
-    lv_opa_t ribbon_opa_ = LV_OPA_COVER;
-    float ribbon_thickness_ratio_ = 0.8f;
-
-    // State
-    float value_ = 0.0f;
-    float origin_ = 0.0f;
-    float ribbon_value_ = 0.0f;
-    bool centered_ = false;
-    bool ribbon_enabled_ = false;
-    uint32_t last_flash_ms_ = 0;
-
-    // Size policy
-    SquareSizePolicy size_policy_;
-
-    // Cached geometry (computed from actual size) - all float for precision
-    float knob_size_ = 0.0f;
-    float arc_radius_ = 0.0f;
-    float indicator_thickness_ = 0.0f;
-    float center_x_ = 0.0f;  // container width / 2
-    float center_y_ = 0.0f;  // container height / 2
+    friend class KnobBank;
+
+    /** @brief State committed by KnobBank: values clamped, angles as knob_angle indices */
+    struct BankUpdate {
+        float value;
+        float origin;
+        float ribbon;
+        uint16_t value_idx;
+        uint16_t origin_idx;
+        uint16_t ribbon_idx;
+        bool value_changed;
+        bool origin_changed;
+        bool ribbon_changed;
+    };
+
+    /**
+     * @brief KnobBank::commit() path: no clamp, epsilon test or index lookup
+     * of its own, and one hidden check for value, origin and ribbon together
+     */
+    void applyBankUpdate(const BankUpdate& update, bool flash);
+
+    lv_obj_t* obj_ = nullptr;  // Knob object, holds all widget state
 };
 
 }  // namespace oc::ui::lvgl
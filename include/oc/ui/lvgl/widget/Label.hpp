@@ -1,10 +1,14 @@
 #pragma once
 
-#include <string>
-
 #include <lvgl.h>
 
 #include <oc/ui/lvgl/IWidget.hpp>
+#include <oc/ui/lvgl/ObjectTree.hpp>
+#include <oc/ui/lvgl/StaticAlloc.hpp>
+
+#if !OC_UI_LVGL_STATIC_ALLOC
+#include <string>
+#endif
 
 #include "../theme/BaseTheme.hpp"
 
@@ -51,6 +55,12 @@ namespace oc::ui::lvgl {
  * @code
  * label.flexGrow(true);  // Expands to fill available space in flex container
  * @endcode
+ *
+ * ## Lean Tree
+ *
+ * Label(parent, ObjectTree::Lean) is a single lv_label (getElement() and
+ * getLabel() return the same object) scrolled by LVGL's own long mode,
+ * without clip container, measure timer or size event.
  */
 class Label : public IWidget {
 public:
@@ -58,7 +68,7 @@ public:
     // Construction / Destruction
     // =========================================================================
 
-    explicit Label(lv_obj_t* parent);
+    explicit Label(lv_obj_t* parent, ObjectTree tree = ObjectTree::Standard);
     ~Label();
 
     // Move only
@@ -159,8 +169,10 @@ public:
     // Data Setters
     // =========================================================================
 
-    /** @brief Set label text */
+    /** @brief Set label text (truncated to OC_UI_LVGL_TEXT_MAX - 1 in static mode) */
+#if !OC_UI_LVGL_STATIC_ALLOC
     void setText(const std::string& text);
+#endif
     void setText(const char* text);
 
     /**
@@ -182,25 +194,39 @@ public:
 
 private:
     void createWidgets(lv_obj_t* parent);
+    void createLeanWidgets(lv_obj_t* parent);
+    void applyLeanMode();
     void cleanup();
 
     void checkOverflowAndScroll();
     void applyStaticAlignment();
     void startScrollAnimation();
     void stopScrollAnimation();
+    void scheduleMeasure(uint32_t delay_ms);
+    bool deferIfHidden();
+    void createMeasureTimer();
+    void createPauseTimer();
+    void relinkCallbacks(void* previous);
 
     static void scrollAnimCallback(void* var, int32_t value);
+    static void measureTimerCallback(lv_timer_t* timer);
     static void pauseTimerCallback(lv_timer_t* timer);
     static void sizeChangedCallback(lv_event_t* e);
 
     lv_obj_t* container_ = nullptr;
     lv_obj_t* label_ = nullptr;
     lv_anim_t scroll_anim_;
-    lv_timer_t* pending_timer_ = nullptr;
+    lv_timer_t* pending_timer_ = nullptr;  // Deferred measure, paused when idle
+    lv_timer_t* pause_timer_ = nullptr;    // Between scroll-out and scroll-back, paused when idle
+#if OC_UI_LVGL_STATIC_ALLOC
+    char text_[OC_UI_LVGL_TEXT_MAX] = {};  // Static text of label_
+#endif
 
     bool auto_scroll_enabled_ = true;
     bool anim_running_ = false;
     bool owns_lvgl_objects_ = true;
+    bool lean_ = false;      // ObjectTree::Lean: container_ == label_
+    bool deferred_ = false;  // Text set while hidden, measured once visible
     lv_coord_t overflow_amount_ = 0;
     lv_text_align_t alignment_ = LV_TEXT_ALIGN_CENTER;
 
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief How a KnobWidget reduces ribbon samples to what is displayed
+ */
+enum class RibbonMode {
+    Latest,    ///< Last sample of the frame
+    Envelope,  ///< Ribbon spans min..max of the frame's samples
+    Smooth     ///< One-pole low-pass of the per-frame mean
+};
+
+/**
+ * @brief Lock-free sample buffer feeding a knob ribbon
+ *
+ * Modulation sources run far faster than the display. push() may be called
+ * from any thread (or ISR) without locking; samples land in a small ring of
+ * packed 32-bit slots (16-bit sequence tag + 16-bit quantized value).
+ * drain() runs on the LVGL thread once per frame and reduces everything
+ * pushed since the previous drain. When producers outrun the ring, the
+ * oldest samples are dropped.
+ *
+ * Usually used through KnobWidget::ribbonFeed() / pushRibbonSample().
+ */
+class RibbonFeed {
+public:
+    static constexpr uint32_t CAPACITY = 64;  // Power of two
+
+    /**
+     * @brief Reduction of one frame worth of samples
+     */
+    struct Frame {
+        float min = 0.0f;
+        float max = 0.0f;
+        float last = 0.0f;
+        float mean = 0.0f;
+        uint32_t count = 0;    ///< Samples reduced
+        uint32_t dropped = 0;  ///< Samples lost (overwritten or still being written)
+    };
+
+    /**
+     * @brief Queue a normalized sample (0.0-1.0). Lock-free, any thread.
+     */
+    void push(float value);
+
+    /**
+     * @brief Reduce samples pushed since last call (LVGL thread only)
+     * @return false if no sample arrived
+     */
+    bool drain(Frame& out);
+
+private:
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+    std::array<std::atomic<uint32_t>, CAPACITY> slots_{};
+    std::atomic<uint32_t> write_{0};
+    uint32_t read_ = 0;  // Consumer only
+};
+
+}  // namespace oc::ui::lvgl
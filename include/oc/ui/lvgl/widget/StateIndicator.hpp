@@ -15,6 +15,8 @@ namespace oc::ui::lvgl {
  *
  * Simple circular indicator with customizable colors and opacities
  * for different states: OFF, ACTIVE, PRESSED.
+ * The LED is its own LVGL object class holding that configuration, so
+ * StateIndicator is a one-pointer handle, cheap to keep in arrays.
  *
  * Usage:
  * @code
@@ -53,18 +55,13 @@ public:
 
     // State
     void setState(State state);
-    State getState() const { return current_state_; }
+    State getState() const;
 
-private:
-    void applyState();
-
-    lv_obj_t* led_ = nullptr;
-    State current_state_ = State::OFF;
+    /** @brief LVGL class of indicator objects (e.g. for lv_obj_check_type) */
+    static const lv_obj_class_t* objClass();
 
-    // Colors indexed by State enum (0=OFF, 1=ACTIVE, 2=PRESSED)
-    uint32_t colors_[3] = {0, 0, 0};
-    // Opacities indexed by State enum, 0 = use default
-    lv_opa_t opacities_[3] = {0, 0, 0};
+private:
+    lv_obj_t* led_ = nullptr;  // LED object, holds state, colors and opacities
 };
 
 }  // namespace oc::ui::lvgl
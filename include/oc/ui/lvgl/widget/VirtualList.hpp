@@ -27,12 +27,15 @@
  * @endcode
  */
 
-#include <functional>
-#include <vector>
-
 #include <lvgl.h>
 
 #include <oc/ui/lvgl/IComponent.hpp>
+#include <oc/ui/lvgl/StaticAlloc.hpp>
+
+#if !OC_UI_LVGL_STATIC_ALLOC
+#include <functional>
+#include <vector>
+#endif
 
 namespace oc::ui::lvgl::widget {
 
@@ -52,7 +55,7 @@ enum class ScrollMode {
  * @brief A reusable slot in the VirtualList
  */
 struct VirtualSlot {
-    lv_obj_t* container = nullptr;  ///< LVGL container (created by VirtualList)
+    lv_obj_t* container = nullptr;  ///< Lean LVGL container (created by VirtualList, not clickable)
     int boundIndex = -1;            ///< Currently bound logical index (-1 = unbound)
     void* userData = nullptr;       ///< Free pointer for owner (reusable widgets)
 };
@@ -68,8 +71,15 @@ struct VirtualSlot {
  * - Reuse/update existing widgets in slot.userData
  * - OR create widgets if slot.userData == nullptr (first bind)
  * - Apply highlighted style if isSelected == true
+ *
+ * With OC_UI_LVGL_STATIC_ALLOC this is a plain function pointer (non-owning,
+ * no capture): keep owner state in slot.userData.
  */
+#if OC_UI_LVGL_STATIC_ALLOC
+using BindSlotCallback = void (*)(VirtualSlot& slot, int index, bool isSelected);
+#else
 using BindSlotCallback = std::function<void(VirtualSlot& slot, int index, bool isSelected)>;
+#endif
 
 /**
  * @brief Optional callback to update only the highlight state
@@ -77,7 +87,20 @@ using BindSlotCallback = std::function<void(VirtualSlot& slot, int index, bool i
  * Called when only the selection state changes (not the bound index).
  * If not provided, onBindSlot is called instead.
  */
+#if OC_UI_LVGL_STATIC_ALLOC
+using UpdateHighlightCallback = void (*)(VirtualSlot& slot, bool isSelected);
+#else
 using UpdateHighlightCallback = std::function<void(VirtualSlot& slot, bool isSelected)>;
+#endif
+
+/**
+ * @brief Slot storage: fixed array of OC_UI_LVGL_LIST_MAX_SLOTS in static mode
+ */
+#if OC_UI_LVGL_STATIC_ALLOC
+using VirtualSlotArray = FixedVector<VirtualSlot, OC_UI_LVGL_LIST_MAX_SLOTS>;
+#else
+using VirtualSlotArray = std::vector<VirtualSlot>;
+#endif
 
 // ══════════════════════════════════════════════════════════════════════════════
 // VirtualList
@@ -113,7 +136,8 @@ public:
 
     /**
      * @brief Set number of visible slots
-     * @param count Number of items visible at once (default: 5)
+     * @param count Number of items visible at once (default: 5,
+     *        at most OC_UI_LVGL_LIST_MAX_SLOTS in static mode)
      */
     VirtualList& visibleCount(int count);
 
@@ -228,7 +252,7 @@ public:
     /**
      * @brief Get all slots (for iteration)
      */
-    const std::vector<VirtualSlot>& getSlots() const { return slots_; }
+    const VirtualSlotArray& getSlots() const { return slots_; }
 
     /**
      * @brief Get the first visible logical index
@@ -264,12 +288,13 @@ private:
     static void scrollAnimCallback(void* var, int32_t value);
 
     // Event handlers
+    void relinkCallbacks(void* previous);
     static void sizeChangedCallback(lv_event_t* e);
 
     lv_obj_t* parent_ = nullptr;
     lv_obj_t* container_ = nullptr;
 
-    std::vector<VirtualSlot> slots_;
+    VirtualSlotArray slots_;
     int visibleCount_ = 5;
     int itemHeight_ = 0;        // 0 = auto-calculate
     bool autoSizing_ = true;    // Calculate itemHeight from container size
@@ -0,0 +1,90 @@
+#include <oc/ui/lvgl/Deferred.hpp>
+
+#include <oc/ui/lvgl/StaticAlloc.hpp>
+#include <oc/ui/lvgl/Trace.hpp>
+
+#if !OC_UI_LVGL_STATIC_ALLOC
+#include <vector>
+#endif
+
+namespace oc::ui::lvgl::deferred {
+
+namespace {
+
+struct Entry {
+    const lv_obj_t* obj = nullptr;
+    ApplyFn apply = nullptr;
+    void* target = nullptr;
+};
+
+#if OC_UI_LVGL_STATIC_ALLOC
+using EntryArray = FixedVector<Entry, OC_UI_LVGL_DEFERRED_MAX>;
+#else
+using EntryArray = std::vector<Entry>;
+#endif
+
+EntryArray entries;
+
+void removeAt(size_t i) {
+    // Order doesn't matter: swap with the last entry
+    entries[i] = entries[entries.size() - 1];
+    entries.pop_back();
+}
+
+}  // namespace
+
+bool isHidden(const lv_obj_t* obj) {
+    for (; obj; obj = lv_obj_get_parent(obj)) {
+        if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return true;
+    }
+    return false;
+}
+
+bool defer(const lv_obj_t* obj, ApplyFn apply, void* target) {
+#if OC_UI_LVGL_STATIC_ALLOC
+    if (entries.size() == entries.capacity()) return false;
+#endif
+    entries.push_back({obj, apply, target});
+    return true;
+}
+
+void cancel(void* target) {
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (entries[i].target == target) {
+            removeAt(i);
+            return;
+        }
+    }
+}
+
+void retarget(void* from, void* to) {
+    for (auto& entry : entries) {
+        if (entry.target == from) entry.target = to;
+    }
+}
+
+uint32_t flush() {
+    if (entries.empty()) return 0;
+    OC_UI_TRACE_SCOPE("deferred::flush");
+
+    uint32_t applied = 0;
+    size_t i = 0;
+    while (i < entries.size()) {
+        Entry entry = entries[i];
+        if (isHidden(entry.obj)) {
+            i++;
+            continue;
+        }
+        // Removed first: apply() may defer other widgets or cancel itself
+        removeAt(i);
+        entry.apply(entry.target);
+        applied++;
+    }
+    return applied;
+}
+
+size_t pending() {
+    return entries.size();
+}
+
+}  // namespace oc::ui::lvgl::deferred
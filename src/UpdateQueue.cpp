@@ -0,0 +1,259 @@
+#include <oc/ui/lvgl/UpdateQueue.hpp>
+
+#include <cstring>
+
+#include <oc/ui/lvgl/widget/ButtonWidget.hpp>
+#include <oc/ui/lvgl/widget/EnumWidget.hpp>
+#include <oc/ui/lvgl/widget/KnobWidget.hpp>
+#include <oc/ui/lvgl/widget/Label.hpp>
+#include <oc/ui/lvgl/widget/StateIndicator.hpp>
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+// Handle = (generation << 16) | (index + 1), so 0 is never a valid handle
+constexpr uint32_t handleIndex(uint32_t handle) { return (handle & 0xFFFFu) - 1; }
+constexpr uint16_t handleGeneration(uint32_t handle) { return static_cast<uint16_t>(handle >> 16); }
+
+}  // namespace
+
+// =============================================================================
+// Construction / Destruction
+// =============================================================================
+
+UpdateQueue::UpdateQueue() {
+    for (uint32_t i = 0; i < CAPACITY; i++) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+UpdateQueue::~UpdateQueue() {
+    detach();
+}
+
+// =============================================================================
+// Producers
+// =============================================================================
+
+bool UpdateQueue::push(const Command& command) {
+    // Bounded MPSC ring: each cell's sequence says whose turn it is
+    uint32_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells_[pos & (CAPACITY - 1)];
+        uint32_t seq = cell->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<int32_t>(seq - pos);
+        if (diff == 0) {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);  // Full
+            return false;
+        } else {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+    cell->command = command;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool UpdateQueue::setValue(Handle target, float value) {
+    Command command;
+    command.target = target;
+    command.op = Op::SetValue;
+    command.value = value;
+    return push(command);
+}
+
+bool UpdateQueue::setText(Handle target, const char* text) {
+    Command command;
+    command.target = target;
+    command.op = Op::SetText;
+    if (text) std::strncpy(command.text, text, TEXT_MAX - 1);
+    return push(command);
+}
+
+bool UpdateQueue::setState(Handle target, int32_t state) {
+    Command command;
+    command.target = target;
+    command.op = Op::SetState;
+    command.state = state;
+    return push(command);
+}
+
+bool UpdateQueue::flash(Handle target) {
+    Command command;
+    command.target = target;
+    command.op = Op::Flash;
+    return push(command);
+}
+
+// =============================================================================
+// Targets
+// =============================================================================
+
+UpdateQueue::Handle UpdateQueue::add(KnobWidget& knob) {
+    return addTarget(Kind::Knob, &knob, nullptr);
+}
+
+UpdateQueue::Handle UpdateQueue::add(Label& label) {
+    return addTarget(Kind::Label, &label, nullptr);
+}
+
+UpdateQueue::Handle UpdateQueue::add(ButtonWidget& button) {
+    return addTarget(Kind::Button, &button, nullptr);
+}
+
+UpdateQueue::Handle UpdateQueue::add(StateIndicator& indicator) {
+    return addTarget(Kind::Indicator, &indicator, nullptr);
+}
+
+UpdateQueue::Handle UpdateQueue::add(EnumWidget& enumWidget) {
+    return addTarget(Kind::Enum, &enumWidget, nullptr);
+}
+
+UpdateQueue::Handle UpdateQueue::add(void* ctx, ApplyFn apply) {
+    if (!apply) return 0;
+    return addTarget(Kind::Custom, ctx, apply);
+}
+
+UpdateQueue::Handle UpdateQueue::addTarget(Kind kind, void* ptr, ApplyFn apply) {
+    for (uint32_t i = 0; i < MAX_TARGETS; i++) {
+        Target& target = targets_[i];
+        if (target.kind != Kind::Free) continue;
+        target.kind = kind;
+        target.ptr = ptr;
+        target.apply = apply;
+        return (static_cast<uint32_t>(target.generation) << 16) | (i + 1);
+    }
+    return 0;
+}
+
+void UpdateQueue::remove(Handle handle) {
+    Target* target = resolve(handle);
+    if (!target) return;
+    target->kind = Kind::Free;
+    target->ptr = nullptr;
+    target->apply = nullptr;
+    target->generation++;  // Invalidates handles still in the queue
+}
+
+UpdateQueue::Target* UpdateQueue::resolve(Handle handle) {
+    uint32_t index = handleIndex(handle);
+    if (handle == 0 || index >= MAX_TARGETS) return nullptr;
+    Target& target = targets_[index];
+    if (target.kind == Kind::Free || target.generation != handleGeneration(handle)) return nullptr;
+    return &target;
+}
+
+// =============================================================================
+// Consumer
+// =============================================================================
+
+void UpdateQueue::attach() {
+    detach();
+    // Own timer, not LV_EVENT_REFR_START: the refresh timer is paused while
+    // nothing is invalidated, and queued commands must still be applied
+    drain_timer_ = lv_timer_create(drainTimerCallback, LV_DEF_REFR_PERIOD, this);
+}
+
+void UpdateQueue::detach() {
+    if (drain_timer_) {
+        lv_timer_delete(drain_timer_);
+        drain_timer_ = nullptr;
+    }
+}
+
+void UpdateQueue::drainTimerCallback(lv_timer_t* timer) {
+    auto* self = static_cast<UpdateQueue*>(lv_timer_get_user_data(timer));
+    if (self) self->drain();
+}
+
+bool UpdateQueue::pop(Command& out) {
+    Cell& cell = cells_[dequeue_pos_ & (CAPACITY - 1)];
+    uint32_t seq = cell.sequence.load(std::memory_order_acquire);
+    if (static_cast<int32_t>(seq - (dequeue_pos_ + 1)) < 0) return false;  // Empty or still being written
+
+    out = cell.command;
+    cell.sequence.store(dequeue_pos_ + CAPACITY, std::memory_order_release);
+    dequeue_pos_++;
+    return true;
+}
+
+uint32_t UpdateQueue::drain() {
+    uint32_t count = 0;
+    while (count < CAPACITY && pop(scratch_[count])) count++;
+    if (count == 0) return 0;
+
+    // Pass 1: remember the last command index per (target, op)
+    for (uint32_t i = 0; i < count; i++) {
+        const Command& command = scratch_[i];
+        Target* target = resolve(command.target);
+        if (target && command.op < Op::COUNT) target->last[static_cast<int>(command.op)] = static_cast<uint16_t>(i);
+    }
+
+    // Pass 2: apply only those, in queue order
+    uint32_t applied = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        const Command& command = scratch_[i];
+        Target* target = resolve(command.target);
+        if (!target || command.op >= Op::COUNT) {
+            stats_.stale++;
+        } else if (target->last[static_cast<int>(command.op)] != i) {
+            stats_.folded++;
+        } else if (apply(*target, command)) {
+            applied++;
+        } else {
+            stats_.stale++;
+        }
+    }
+    stats_.applied += applied;
+    return applied;
+}
+
+bool UpdateQueue::apply(const Target& target, const Command& command) {
+    switch (target.kind) {
+        case Kind::Knob:
+            if (command.op != Op::SetValue) return false;
+            static_cast<KnobWidget*>(target.ptr)->setValue(command.value);
+            return true;
+        case Kind::Label:
+            if (command.op != Op::SetText) return false;
+            static_cast<Label*>(target.ptr)->setText(command.text);
+            return true;
+        case Kind::Button:
+            if (command.op == Op::SetState) {
+                static_cast<ButtonWidget*>(target.ptr)->setState(command.state != 0);
+                return true;
+            }
+            if (command.op == Op::SetText) {
+                static_cast<ButtonWidget*>(target.ptr)->setText(command.text);
+                return true;
+            }
+            return false;
+        case Kind::Indicator:
+            if (command.op != Op::SetState) return false;
+            static_cast<StateIndicator*>(target.ptr)->setState(static_cast<StateIndicator::State>(command.state));
+            return true;
+        case Kind::Enum:
+            if (command.op != Op::Flash) return false;
+            static_cast<EnumWidget*>(target.ptr)->triggerFlash();
+            return true;
+        case Kind::Custom:
+            target.apply(target.ptr, command);
+            return true;
+        case Kind::Free:
+            break;
+    }
+    return false;
+}
+
+UpdateQueue::Stats UpdateQueue::stats() const {
+    Stats stats = stats_;
+    stats.pushed = enqueue_pos_.load(std::memory_order_relaxed);
+    stats.rejected = rejected_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,141 @@
+#include <oc/ui/lvgl/component/PageCache.hpp>
+
+#include <algorithm>
+
+#include <oc/ui/lvgl/Deferred.hpp>
+#include <oc/ui/lvgl/Trace.hpp>
+
+namespace oc::ui::lvgl {
+
+PageCache::PageCache(lv_obj_t* parent, size_t budgetBytes) : parent_(parent), budget_(budgetBytes) {}
+
+PageCache::~PageCache() {
+    // Pages delete their own LVGL objects
+    entries_.clear();
+}
+
+void PageCache::add(PageId id, Builder build, Saver save) {
+    Entry* entry = find(id);
+    if (!entry) {
+        entries_.emplace_back();
+        entry = &entries_.back();
+        entry->id = id;
+    }
+    entry->build = std::move(build);
+    entry->save = std::move(save);
+}
+
+IComponent* PageCache::show(PageId id) {
+    OC_UI_TRACE_SCOPE("PageCache::show");
+
+    Entry* entry = find(id);
+    if (!entry || !entry->build) return nullptr;
+
+    if (has_current_ && current_ != id) {
+        Entry* previous = find(current_);
+        if (previous && previous->page) previous->page->hide();
+    }
+
+    if (entry->page) {
+        stats_.hits++;
+    } else {
+        stats_.misses++;
+        if (entry->evicted) stats_.rebuilds++;
+        entry->evicted = false;
+
+        uint32_t start = nowUs();
+        entry->page = entry->build(parent_, entry->state);
+        uint32_t elapsed = nowUs() - start;
+        stats_.last_build_us = elapsed;
+        stats_.max_build_us = std::max(stats_.max_build_us, elapsed);
+        stats_.total_build_us += elapsed;
+        if (!entry->page) {
+            has_current_ = false;
+            return nullptr;
+        }
+    }
+
+    entry->page->show();
+    deferred::flush();  // Widgets updated while the page was hidden
+    entry->last_used = ++use_counter_;
+    current_ = id;
+    has_current_ = true;
+
+    trim();
+    return entry->page.get();
+}
+
+size_t PageCache::trim() {
+    size_t evicted = 0;
+    while (usedBytes() > budget_) {
+        // Least recently used page that is built and not on screen
+        Entry* lru = nullptr;
+        for (auto& entry : entries_) {
+            if (!entry.page || (has_current_ && entry.id == current_)) continue;
+            if (!lru || entry.last_used < lru->last_used) lru = &entry;
+        }
+        if (!lru) break;
+        evict(*lru);
+        evicted++;
+    }
+    return evicted;
+}
+
+void PageCache::clear() {
+    for (auto& entry : entries_) {
+        if (entry.page && !(has_current_ && entry.id == current_)) evict(entry);
+    }
+}
+
+void PageCache::evict(Entry& entry) {
+    OC_UI_TRACE_SCOPE("PageCache::evict");
+
+    entry.state.clear();
+    if (entry.save) entry.save(*entry.page, entry.state);
+    entry.page.reset();
+    entry.evicted = true;
+    stats_.evictions++;
+}
+
+IComponent* PageCache::current() const {
+    if (!has_current_) return nullptr;
+    const Entry* entry = find(current_);
+    return entry ? entry->page.get() : nullptr;
+}
+
+bool PageCache::isCached(PageId id) const {
+    const Entry* entry = find(id);
+    return entry && entry->page;
+}
+
+size_t PageCache::cachedCount() const {
+    return static_cast<size_t>(std::count_if(entries_.begin(), entries_.end(),
+                                             [](const Entry& entry) { return entry.page != nullptr; }));
+}
+
+size_t PageCache::usedBytes() const {
+    if (probe_) return probe_();
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size > mon.free_size ? mon.total_size - mon.free_size : 0;
+}
+
+PageCache::Entry* PageCache::find(PageId id) {
+    for (auto& entry : entries_) {
+        if (entry.id == id) return &entry;
+    }
+    return nullptr;
+}
+
+const PageCache::Entry* PageCache::find(PageId id) const {
+    for (const auto& entry : entries_) {
+        if (entry.id == id) return &entry;
+    }
+    return nullptr;
+}
+
+uint32_t PageCache::nowUs() const {
+    return clock_ ? clock_() : lv_tick_get() * 1000u;
+}
+
+}  // namespace oc::ui::lvgl
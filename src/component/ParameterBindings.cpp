@@ -0,0 +1,241 @@
+#include <oc/ui/lvgl/component/ParameterBindings.hpp>
+
+#include <cstring>
+
+#include <oc/ui/lvgl/Trace.hpp>
+#include <oc/ui/lvgl/component/ParameterEnum.hpp>
+#include <oc/ui/lvgl/component/ParameterKnob.hpp>
+#include <oc/ui/lvgl/component/ParameterSwitch.hpp>
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+constexpr uint32_t WORD_BITS = 32;
+constexpr size_t MAX_BINDINGS = 0xFFFF;  // Param::binding is 16-bit
+
+inline uint32_t lowestBit(uint32_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_ctz(bits));
+#else
+    uint32_t n = 0;
+    while (!(bits & 1u)) {
+        bits >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+}  // namespace
+
+// =============================================================================
+// Construction / Destruction
+// =============================================================================
+
+ParameterBindings::ParameterBindings(uint32_t capacity)
+    : capacity_(capacity),
+      params_(capacity),
+      dirty_((capacity + WORD_BITS - 1) / WORD_BITS, 0) {}
+
+ParameterBindings::~ParameterBindings() {
+    detach();
+}
+
+// =============================================================================
+// Bindings
+// =============================================================================
+
+bool ParameterBindings::bind(ParameterId id, ParameterKnob& knob, Label* valueLabel) {
+    return bindComponent(id, Kind::Knob, &knob, valueLabel);
+}
+
+bool ParameterBindings::bind(ParameterId id, ParameterEnum& param) {
+    return bindComponent(id, Kind::Enum, &param, nullptr);
+}
+
+bool ParameterBindings::bind(ParameterId id, ParameterSwitch& param) {
+    return bindComponent(id, Kind::Switch, &param, nullptr);
+}
+
+bool ParameterBindings::bindComponent(ParameterId id, Kind kind, void* component, Label* valueLabel) {
+    if (id >= capacity_) return false;
+    Param& param = params_[id];
+
+    if (param.binding == 0) {
+        size_t slot = 0;
+        while (slot < bindings_.size() && bindings_[slot].component) slot++;
+        if (slot == bindings_.size()) {
+            if (slot >= MAX_BINDINGS) return false;
+            bindings_.emplace_back();
+        }
+        param.binding = static_cast<uint16_t>(slot + 1);
+    }
+
+    Binding& binding = bindings_[param.binding - 1];
+    binding = Binding{};
+    binding.kind = kind;
+    binding.component = component;
+    binding.value_label = valueLabel;
+
+    // Show the current state on the next sweep
+    mark(id, param.ribbon_set ? FIELD_VALUE | FIELD_RIBBON : FIELD_VALUE);
+    return true;
+}
+
+void ParameterBindings::unbind(ParameterId id) {
+    if (id >= capacity_) return;
+    Param& param = params_[id];
+    if (param.binding == 0) return;
+
+    bindings_[param.binding - 1] = Binding{};
+    param.binding = 0;
+    dirty_[id / WORD_BITS] &= ~(1u << (id % WORD_BITS));
+}
+
+bool ParameterBindings::format(ParameterId id, Formatter formatter) {
+    if (id >= capacity_ || params_[id].binding == 0) return false;
+    bindings_[params_[id].binding - 1].formatter = formatter;
+    mark(id, FIELD_VALUE);
+    return true;
+}
+
+// =============================================================================
+// Parameter changes
+// =============================================================================
+
+bool ParameterBindings::setValue(ParameterId id, float value) {
+    stats_.sets++;
+    if (id >= capacity_) return false;
+    Param& param = params_[id];
+    if (param.value == value) return false;
+    param.value = value;
+    return mark(id, FIELD_VALUE);
+}
+
+bool ParameterBindings::setRibbon(ParameterId id, float value) {
+    stats_.sets++;
+    if (id >= capacity_) return false;
+    Param& param = params_[id];
+    if (param.ribbon_set && param.ribbon == value) return false;
+    param.ribbon = value;
+    param.ribbon_set = true;
+    return mark(id, FIELD_RIBBON);
+}
+
+bool ParameterBindings::setText(ParameterId id, const char* text) {
+    stats_.sets++;
+    if (id >= capacity_ || !text || params_[id].binding == 0) return false;
+
+    // Text is only kept for bound parameters
+    Binding& binding = bindings_[params_[id].binding - 1];
+    if (binding.has_text && std::strncmp(binding.text, text, TEXT_MAX - 1) == 0) return false;
+    std::strncpy(binding.text, text, TEXT_MAX - 1);
+    binding.text[TEXT_MAX - 1] = '\0';
+    binding.has_text = true;
+    return mark(id, FIELD_TEXT);
+}
+
+bool ParameterBindings::mark(ParameterId id, uint8_t field) {
+    Param& param = params_[id];
+    if (param.binding == 0) return false;
+
+    uint32_t& word = dirty_[id / WORD_BITS];
+    uint32_t bit = 1u << (id % WORD_BITS);
+    if (word & bit) {
+        param.changed |= field;
+    } else {
+        word |= bit;
+        param.changed = field;
+        stats_.marked++;
+    }
+    return true;
+}
+
+// =============================================================================
+// Sweep
+// =============================================================================
+
+void ParameterBindings::attach() {
+    detach();
+    // Own timer, not LV_EVENT_REFR_START: setValue() invalidates nothing, so
+    // the refresh timer may stay paused with parameters still dirty
+    sweep_timer_ = lv_timer_create(sweepTimerCallback, LV_DEF_REFR_PERIOD, this);
+}
+
+void ParameterBindings::detach() {
+    if (sweep_timer_) {
+        lv_timer_delete(sweep_timer_);
+        sweep_timer_ = nullptr;
+    }
+}
+
+void ParameterBindings::sweepTimerCallback(lv_timer_t* timer) {
+    auto* self = static_cast<ParameterBindings*>(lv_timer_get_user_data(timer));
+    if (self) self->sweep();
+}
+
+uint32_t ParameterBindings::sweep() {
+    OC_UI_TRACE_SCOPE("ParameterBindings::sweep");
+
+    uint32_t applied = 0;
+    for (size_t w = 0; w < dirty_.size(); w++) {
+        uint32_t bits = dirty_[w];
+        if (!bits) continue;
+        dirty_[w] = 0;
+
+        while (bits) {
+            auto id = static_cast<ParameterId>(w * WORD_BITS + lowestBit(bits));
+            bits &= bits - 1;
+
+            const Param& param = params_[id];
+            if (param.binding == 0) continue;
+            apply(param, bindings_[param.binding - 1], param.changed);
+            applied++;
+        }
+    }
+    stats_.applied += applied;
+    return applied;
+}
+
+const char* ParameterBindings::valueText(const Param& param, Binding& binding, char* buf) {
+    if (!binding.formatter) return nullptr;
+    buf[0] = '\0';
+    binding.formatter(param.value, buf, TEXT_MAX);
+    return buf;
+}
+
+void ParameterBindings::apply(const Param& param, Binding& binding, uint8_t changed) {
+    // Explicit text wins over formatted value in the same frame
+    char buf[TEXT_MAX];
+    const char* text = nullptr;
+    if ((changed & FIELD_TEXT) && binding.has_text) {
+        text = binding.text;
+    } else if (changed & FIELD_VALUE) {
+        text = valueText(param, binding, buf);
+    }
+
+    switch (binding.kind) {
+        case Kind::Knob: {
+            auto* knob = static_cast<ParameterKnob*>(binding.component);
+            if (changed & FIELD_VALUE) knob->knob().setValue(param.value);
+            if (changed & FIELD_RIBBON) knob->knob().setRibbonValue(param.ribbon);
+            if (text && binding.value_label) binding.value_label->setText(text);
+            break;
+        }
+        case Kind::Enum: {
+            auto* enumParam = static_cast<ParameterEnum*>(binding.component);
+            if (text) enumParam->valueLabel().setText(text);
+            if (changed & (FIELD_VALUE | FIELD_TEXT)) enumParam->enumWidget().triggerFlash();
+            break;
+        }
+        case Kind::Switch: {
+            auto* switchParam = static_cast<ParameterSwitch*>(binding.component);
+            if (changed & FIELD_VALUE) switchParam->button().setState(param.value >= 0.5f);
+            if (text) switchParam->button().setText(text);
+            break;
+        }
+    }
+}
+
+}  // namespace oc::ui::lvgl
@@ -1,11 +1,14 @@
 #include <oc/ui/lvgl/component/ParameterKnob.hpp>
 
+#include <oc/ui/lvgl/Deferred.hpp>
+#include <oc/ui/lvgl/LeanObject.hpp>
+#include <oc/ui/lvgl/Trace.hpp>
 #include <oc/ui/lvgl/theme/BaseTheme.hpp>
 
 namespace oc::ui::lvgl {
 
-ParameterKnob::ParameterKnob(lv_obj_t* parent) {
-    createUI(parent);
+ParameterKnob::ParameterKnob(lv_obj_t* parent, ObjectTree tree) {
+    createUI(parent, tree);
 }
 
 ParameterKnob::~ParameterKnob() {
@@ -31,7 +34,9 @@ ParameterKnob& ParameterKnob::operator=(ParameterKnob&& other) noexcept {
 }
 
 void ParameterKnob::show() {
-    if (container_) lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    if (!container_) return;
+    lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    deferred::flush();  // Widgets updated while hidden
 }
 
 void ParameterKnob::hide() {
@@ -42,17 +47,26 @@ bool ParameterKnob::isVisible() const {
     return container_ && !lv_obj_has_flag(container_, LV_OBJ_FLAG_HIDDEN);
 }
 
-void ParameterKnob::createUI(lv_obj_t* parent) {
+void ParameterKnob::createUI(lv_obj_t* parent, ObjectTree tree) {
+    OC_UI_TRACE_SCOPE("ParameterKnob::createUI");
+
     // Container - 100% of parent, grid layout
-    container_ = lv_obj_create(parent);
+    container_ = lean::create(parent);
     lv_obj_set_size(container_, LV_PCT(100), LV_PCT(100));
-    lv_obj_set_style_bg_opa(container_, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(container_, 0, 0);
-    lv_obj_set_style_pad_all(container_, 0, 0);
-    lv_obj_set_style_pad_row(container_, 0, 0);
-    lv_obj_set_style_pad_column(container_, 0, 0);
     lv_obj_add_flag(container_, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
-    lv_obj_set_scrollbar_mode(container_, LV_SCROLLBAR_MODE_OFF);
+
+    if (tree == ObjectTree::Lean) {
+        // Flex column: full-width square knob, label right below
+        lv_obj_set_flex_flow(container_, LV_FLEX_FLOW_COLUMN);
+        knob_.emplace(container_);
+        knob_->sizeMode(SizeMode::SquareFromWidth);
+        lv_obj_set_width(knob_->getElement(), LV_PCT(100));
+        label_.emplace(container_, tree);
+        label_->alignment(LV_TEXT_ALIGN_CENTER)
+               .color(base_theme::color::TEXT_PRIMARY)
+               .autoScroll(true);
+        return;
+    }
 
     // Grid: 1 column (100%), 2 rows (CONTENT for knob, CONTENT for label)
     // KnobWidget uses SquareSizePolicy to set height = width automatically
@@ -62,14 +76,14 @@ void ParameterKnob::createUI(lv_obj_t* parent) {
     lv_obj_set_layout(container_, LV_LAYOUT_GRID);
 
     // Row 0: KnobWidget - stretch horizontally, CONTENT row sizes to knob height
-    knob_ = std::make_unique<KnobWidget>(container_);
+    knob_.emplace(container_);
     knob_->sizeMode(SizeMode::SquareFromWidth);  // Height = Width
     lv_obj_set_grid_cell(knob_->getElement(),
         LV_GRID_ALIGN_STRETCH, 0, 1,  // col: stretch to get width from grid
         LV_GRID_ALIGN_START, 0, 1);   // row: start in CONTENT row
 
     // Row 1: Label - stretch width, content height
-    label_ = std::make_unique<Label>(container_);
+    label_.emplace(container_);
     lv_obj_set_grid_cell(label_->getElement(),
         LV_GRID_ALIGN_STRETCH, 0, 1,  // col: stretch full width
         LV_GRID_ALIGN_CENTER, 1, 1);  // row: center in CONTENT row
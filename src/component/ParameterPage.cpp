@@ -0,0 +1,190 @@
+#include <oc/ui/lvgl/component/ParameterPage.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <oc/ui/lvgl/LeanObject.hpp>
+#include <oc/ui/lvgl/Trace.hpp>
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+// True if the label already shows text
+bool shows(const char* current, const char* text) {
+    return std::strcmp(current ? current : "", text) == 0;
+}
+
+bool shows(const Label& label, const char* text) {
+    return label.getLabel() && shows(lv_label_get_text(label.getLabel()), text);
+}
+
+}  // namespace
+
+// =============================================================================
+// Construction / Destruction
+// =============================================================================
+
+ParameterPage::ParameterPage(lv_obj_t* parent, uint8_t cols, uint8_t rows, ObjectTree tree)
+    : cols_(cols), rows_(rows), tree_(tree), slots_(static_cast<size_t>(cols) * rows) {
+    OC_UI_TRACE_SCOPE("ParameterPage::createUI");
+
+    container_ = lean::create(parent);
+    lv_obj_set_size(container_, LV_PCT(100), LV_PCT(100));
+
+    col_dsc_.assign(cols_, LV_GRID_FR(1));
+    col_dsc_.push_back(LV_GRID_TEMPLATE_LAST);
+    row_dsc_.assign(rows_, LV_GRID_FR(1));
+    row_dsc_.push_back(LV_GRID_TEMPLATE_LAST);
+    lv_obj_set_grid_dsc_array(container_, col_dsc_.data(), row_dsc_.data());
+    lv_obj_set_layout(container_, LV_LAYOUT_GRID);
+}
+
+ParameterPage::~ParameterPage() {
+    // Components delete their own objects before the container goes
+    knobs_.all.clear();
+    enums_.all.clear();
+    switches_.all.clear();
+    if (container_) {
+        lv_obj_delete(container_);
+        container_ = nullptr;
+    }
+}
+
+// =============================================================================
+// Page switching
+// =============================================================================
+
+size_t ParameterPage::setPage(const ParameterSlot* slots, size_t count) {
+    OC_UI_TRACE_SCOPE("ParameterPage::setPage");
+
+    static const ParameterSlot EMPTY;
+    size_t updated = 0;
+    for (size_t i = 0; i < slots_.size(); i++) {
+        const ParameterSlot& desc = (slots && i < count) ? slots[i] : EMPTY;
+        Slot& slot = slots_[i];
+
+        bool fresh = slot.type != desc.type;
+        if (fresh) swapType(slot, i, desc.type);
+        if (update(slot, desc, fresh) || fresh) updated++;
+    }
+    return updated;
+}
+
+void ParameterPage::swapType(Slot& slot, size_t index, ParameterType type) {
+    switch (slot.type) {
+        case ParameterType::Knob: release(knobs_, static_cast<ParameterKnob*>(slot.component)); break;
+        case ParameterType::Enum: release(enums_, static_cast<ParameterEnum*>(slot.component)); break;
+        case ParameterType::Switch: release(switches_, static_cast<ParameterSwitch*>(slot.component)); break;
+        case ParameterType::None: break;
+    }
+
+    slot = Slot{};
+    slot.type = type;
+    switch (type) {
+        case ParameterType::Knob: slot.component = acquire(knobs_, index); break;
+        case ParameterType::Enum: slot.component = acquire(enums_, index); break;
+        case ParameterType::Switch: slot.component = acquire(switches_, index); break;
+        case ParameterType::None: break;
+    }
+}
+
+template <typename T>
+T* ParameterPage::acquire(Pool<T>& pool, size_t index) {
+    T* component;
+    if (!pool.spare.empty()) {
+        component = pool.spare.back();
+        pool.spare.pop_back();
+    } else {
+        pool.all.push_back(std::make_unique<T>(container_, tree_));
+        component = pool.all.back().get();
+    }
+    lv_obj_set_grid_cell(component->getElement(),
+        LV_GRID_ALIGN_STRETCH, static_cast<int32_t>(index % cols_), 1,
+        LV_GRID_ALIGN_STRETCH, static_cast<int32_t>(index / cols_), 1);
+    component->show();
+    return component;
+}
+
+template <typename T>
+void ParameterPage::release(Pool<T>& pool, T* component) {
+    if (!component) return;
+    component->hide();  // Hidden objects are skipped by the grid layout
+    pool.spare.push_back(component);
+}
+
+bool ParameterPage::update(Slot& slot, const ParameterSlot& desc, bool fresh) {
+    if (slot.type == ParameterType::None) return false;
+
+    // Recycled components still show their previous parameter: apply all.
+    // Name, value and texts are checked against the widgets, which may have
+    // been edited live since the last setPage().
+    const char* name = desc.name ? desc.name : "";
+    const char* value_text = desc.valueText ? desc.valueText : "";
+    bool color_changed = slot.color != desc.color || fresh;
+    bool centered_changed = slot.centered != desc.centered || fresh;
+    slot.color = desc.color;
+    slot.centered = desc.centered;
+
+    switch (slot.type) {
+        case ParameterType::Knob: {
+            auto* param = static_cast<ParameterKnob*>(slot.component);
+            bool name_changed = fresh || !shows(param->label(), name);
+            if (name_changed) param->label().setText(name);
+            if (color_changed) param->knob().trackColor(slot.color);
+            if (centered_changed) {
+                param->knob().centered(slot.centered);
+                if (!slot.centered) param->knob().origin(0.0f);
+            }
+            // After centered(), which may have moved the value
+            float value = std::clamp(desc.value, 0.0f, 1.0f);
+            bool value_changed = fresh || param->knob().getValue() != value;
+            if (value_changed) param->knob().setValue(value, false);
+            return name_changed || color_changed || centered_changed || value_changed;
+        }
+        case ParameterType::Enum: {
+            auto* param = static_cast<ParameterEnum*>(slot.component);
+            bool name_changed = fresh || !shows(param->nameLabel(), name);
+            bool text_changed = fresh || !shows(param->valueLabel(), value_text);
+            if (name_changed) param->nameLabel().setText(name);
+            if (color_changed) param->enumWidget().lineColor(slot.color);
+            if (text_changed) param->valueLabel().setText(value_text);
+            return name_changed || color_changed || text_changed;
+        }
+        case ParameterType::Switch: {
+            auto* param = static_cast<ParameterSwitch*>(slot.component);
+            bool name_changed = fresh || !shows(param->label(), name);
+            bool value_changed = fresh || param->button().getState() != (desc.value >= 0.5f);
+            bool text_changed = fresh || !shows(param->button().getText(), value_text);
+            if (name_changed) param->label().setText(name);
+            if (color_changed) param->button().onColor(slot.color);
+            if (value_changed) param->button().setState(desc.value >= 0.5f);
+            if (text_changed) param->button().setText(value_text);
+            return name_changed || color_changed || value_changed || text_changed;
+        }
+        case ParameterType::None:
+            break;
+    }
+    return false;
+}
+
+// =============================================================================
+// Access
+// =============================================================================
+
+ParameterKnob* ParameterPage::knob(size_t slot) const {
+    if (slot >= slots_.size() || slots_[slot].type != ParameterType::Knob) return nullptr;
+    return static_cast<ParameterKnob*>(slots_[slot].component);
+}
+
+ParameterEnum* ParameterPage::enumParam(size_t slot) const {
+    if (slot >= slots_.size() || slots_[slot].type != ParameterType::Enum) return nullptr;
+    return static_cast<ParameterEnum*>(slots_[slot].component);
+}
+
+ParameterSwitch* ParameterPage::switchParam(size_t slot) const {
+    if (slot >= slots_.size() || slots_[slot].type != ParameterType::Switch) return nullptr;
+    return static_cast<ParameterSwitch*>(slots_[slot].component);
+}
+
+}  // namespace oc::ui::lvgl
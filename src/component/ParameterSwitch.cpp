@@ -1,11 +1,14 @@
 #include <oc/ui/lvgl/component/ParameterSwitch.hpp>
 
+#include <oc/ui/lvgl/Deferred.hpp>
+#include <oc/ui/lvgl/LeanObject.hpp>
+#include <oc/ui/lvgl/Trace.hpp>
 #include <oc/ui/lvgl/theme/BaseTheme.hpp>
 
 namespace oc::ui::lvgl {
 
-ParameterSwitch::ParameterSwitch(lv_obj_t* parent) {
-    createUI(parent);
+ParameterSwitch::ParameterSwitch(lv_obj_t* parent, ObjectTree tree) {
+    createUI(parent, tree);
 }
 
 ParameterSwitch::~ParameterSwitch() {
@@ -31,7 +34,9 @@ ParameterSwitch& ParameterSwitch::operator=(ParameterSwitch&& other) noexcept {
 }
 
 void ParameterSwitch::show() {
-    if (container_) lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    if (!container_) return;
+    lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    deferred::flush();  // Widgets updated while hidden
 }
 
 void ParameterSwitch::hide() {
@@ -42,16 +47,25 @@ bool ParameterSwitch::isVisible() const {
     return container_ && !lv_obj_has_flag(container_, LV_OBJ_FLAG_HIDDEN);
 }
 
-void ParameterSwitch::createUI(lv_obj_t* parent) {
+void ParameterSwitch::createUI(lv_obj_t* parent, ObjectTree tree) {
+    OC_UI_TRACE_SCOPE("ParameterSwitch::createUI");
+
     // Container - 100% of parent, grid layout (same pattern as ParameterKnob)
-    container_ = lv_obj_create(parent);
+    container_ = lean::create(parent);
     lv_obj_set_size(container_, LV_PCT(100), LV_PCT(100));
-    lv_obj_set_style_bg_opa(container_, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(container_, 0, 0);
-    lv_obj_set_style_pad_all(container_, 0, 0);
-    lv_obj_set_style_pad_row(container_, 0, 0);
-    lv_obj_set_style_pad_column(container_, 0, 0);
-    lv_obj_set_scrollbar_mode(container_, LV_SCROLLBAR_MODE_OFF);
+
+    if (tree == ObjectTree::Lean) {
+        // Flex column: button centered in the remaining height, label below
+        lv_obj_set_flex_flow(container_, LV_FLEX_FLOW_COLUMN);
+        lv_obj_set_flex_align(container_, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+        button_.emplace(container_);
+        lv_obj_set_flex_grow(button_->getElement(), 1);
+        label_.emplace(container_, tree);
+        label_->alignment(LV_TEXT_ALIGN_CENTER)
+               .color(base_theme::color::TEXT_PRIMARY)
+               .autoScroll(true);
+        return;
+    }
 
     // Grid: 1 column (100%), 2 rows (FR(1) for button, CONTENT for label)
     static int32_t col_dsc[] = {LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
@@ -60,13 +74,13 @@ void ParameterSwitch::createUI(lv_obj_t* parent) {
     lv_obj_set_layout(container_, LV_LAYOUT_GRID);
 
     // Row 0: ButtonWidget - centered in remaining space
-    button_ = std::make_unique<ButtonWidget>(container_);
+    button_.emplace(container_);
     lv_obj_set_grid_cell(button_->getElement(),
         LV_GRID_ALIGN_CENTER, 0, 1,   // col: center
         LV_GRID_ALIGN_CENTER, 0, 1);  // row: center in row 0
 
     // Row 1: Label - stretch width, content height
-    label_ = std::make_unique<Label>(container_);
+    label_.emplace(container_);
     lv_obj_set_grid_cell(label_->getElement(),
         LV_GRID_ALIGN_STRETCH, 0, 1,  // col: stretch full width
         LV_GRID_ALIGN_CENTER, 1, 1);  // row: center in row 1
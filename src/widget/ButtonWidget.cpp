@@ -1,109 +1,256 @@
 #include <oc/ui/lvgl/widget/ButtonWidget.hpp>
 
 #include <algorithm>
-#include <utility>
+#include <cstring>
+#include <new>
+
+#include <lvgl_private.h>  // lv_obj_class_t layout
+
+#include <oc/ui/lvgl/Deferred.hpp>
+#include <oc/ui/lvgl/LeanObject.hpp>
+#include <oc/ui/lvgl/Stats.hpp>
 
 namespace oc::ui::lvgl {
 
+namespace {
+
+/**
+ * Button state, stored in the object's own allocation (see ButtonObject).
+ * The init timer and the class event callback reach it through the
+ * object, so nothing in LVGL points at the ButtonWidget handle.
+ */
+struct ButtonData {
+    // Sizing constants
+    static constexpr float DEFAULT_PADDING_RATIO = 0.25f;  // 25% padding each side = 50% total, button = 50% of container
+    static constexpr float RADIUS_RATIO = 0.15f;           // Corner radius relative to button size
+    static constexpr lv_coord_t MIN_SIZE = 20;             // Minimum button size
+
+    explicit ButtonData(lv_obj_t* obj) : container_(obj) {}
+    ~ButtonData();
+
+    void createUI();
+    void applyState();
+    void updateGeometry();
+    void setText(const char* text);
+    bool deferIfHidden();
+
+    // LVGL objects (children are deleted by LVGL before ~ButtonData runs)
+    lv_obj_t* container_;
+    lv_obj_t* button_box_ = nullptr;
+    lv_obj_t* state_label_ = nullptr;  // Created by setText(), nullptr otherwise
+    lv_timer_t* init_timer_ = nullptr;  // Deferred first geometry
+#if OC_UI_LVGL_STATIC_ALLOC
+    char text_[OC_UI_LVGL_TEXT_MAX] = {};  // Static text of state_label_
+#endif
+
+    // Cached size
+    lv_coord_t button_size_ = 0;
+
+    // State
+    bool is_on_ = false;
+    bool deferred_ = false;  // State changed while hidden, queued in deferred::
+
+    // Configuration
+    uint32_t off_color_ = 0;
+    uint32_t on_color_ = 0;
+    uint32_t text_off_color_ = 0;
+    uint32_t text_on_color_ = 0;
+    float padding_ratio_ = DEFAULT_PADDING_RATIO;
+
+    // Size policy
+    SquareSizePolicy size_policy_;
+};
+
+/** Button instance: LVGL's base object followed by the button state */
+struct ButtonObject {
+    lv_obj_t obj;
+    ButtonData data;
+};
+
+ButtonData* dataOf(void* obj) {
+    return &static_cast<ButtonObject*>(obj)->data;
+}
+
+void constructorCallback(const lv_obj_class_t*, lv_obj_t* obj) {
+    new (dataOf(obj)) ButtonData(obj);
+}
+
+void destructorCallback(const lv_obj_class_t*, lv_obj_t* obj) {
+    dataOf(obj)->~ButtonData();
+}
+
+void eventCallback(const lv_obj_class_t*, lv_event_t* e) {
+    if (lv_obj_event_base(ButtonWidget::objClass(), e) != LV_RESULT_OK) return;
+    if (lv_event_get_code(e) == LV_EVENT_SIZE_CHANGED) {
+        dataOf(lv_event_get_current_target_obj(e))->updateGeometry();
+    }
+}
+
+}  // namespace
+
+// ============================================================================
+// ButtonWidget (handle)
+// ============================================================================
+
+const lv_obj_class_t* ButtonWidget::objClass() {
+    static const lv_obj_class_t cls = [] {
+        lv_obj_class_t c{};
+        c.base_class = &lv_obj_class;
+        c.constructor_cb = constructorCallback;
+        c.destructor_cb = destructorCallback;
+        c.event_cb = eventCallback;
+        c.name = "oc_button";
+        c.width_def = LV_DPI_DEF;
+        c.height_def = LV_DPI_DEF;
+        c.instance_size = sizeof(ButtonObject);
+        c.theme_inheritable = LV_OBJ_CLASS_THEME_INHERITABLE_TRUE;
+        return c;
+    }();
+    return &cls;
+}
+
 ButtonWidget::ButtonWidget(lv_obj_t* parent) {
-    container_ = lv_obj_create(parent);
-    createUI();
+    obj_ = lv_obj_class_create_obj(objClass(), parent);
+    lv_obj_class_init_obj(obj_);
+    dataOf(obj_)->createUI();
 }
 
 ButtonWidget::~ButtonWidget() {
-    cleanup();
-}
-
-ButtonWidget::ButtonWidget(ButtonWidget&& other) noexcept
-    : container_(other.container_),
-      button_box_(other.button_box_),
-      state_label_(other.state_label_),
-      button_size_(other.button_size_),
-      is_on_(other.is_on_),
-      off_color_(other.off_color_),
-      on_color_(other.on_color_),
-      text_off_color_(other.text_off_color_),
-      text_on_color_(other.text_on_color_),
-      padding_ratio_(other.padding_ratio_),
-      size_policy_(other.size_policy_) {
-    other.container_ = nullptr;
-    other.button_box_ = nullptr;
-    other.state_label_ = nullptr;
+    if (obj_) lv_obj_delete(obj_);
+}
+
+ButtonWidget::ButtonWidget(ButtonWidget&& other) noexcept : obj_(other.obj_) {
+    other.obj_ = nullptr;
 }
 
 ButtonWidget& ButtonWidget::operator=(ButtonWidget&& other) noexcept {
     if (this != &other) {
-        cleanup();
-
-        container_ = other.container_;
-        button_box_ = other.button_box_;
-        state_label_ = other.state_label_;
-        button_size_ = other.button_size_;
-        is_on_ = other.is_on_;
-        off_color_ = other.off_color_;
-        on_color_ = other.on_color_;
-        text_off_color_ = other.text_off_color_;
-        text_on_color_ = other.text_on_color_;
-        padding_ratio_ = other.padding_ratio_;
-        size_policy_ = other.size_policy_;
-
-        other.container_ = nullptr;
-        other.button_box_ = nullptr;
-        other.state_label_ = nullptr;
+        if (obj_) lv_obj_delete(obj_);
+        obj_ = other.obj_;
+        other.obj_ = nullptr;
     }
     return *this;
 }
 
-void ButtonWidget::cleanup() {
-    if (container_) {
-        lv_obj_delete(container_);
-        container_ = nullptr;
-    }
-    button_box_ = nullptr;
-    state_label_ = nullptr;
+lv_obj_t* ButtonWidget::inner() const {
+    return obj_ ? dataOf(obj_)->button_box_ : nullptr;
+}
+
+// Fluent setters
+ButtonWidget& ButtonWidget::offColor(uint32_t color) {
+    if (!obj_) return *this;
+    dataOf(obj_)->off_color_ = color;
+    dataOf(obj_)->applyState();
+    return *this;
+}
+
+ButtonWidget& ButtonWidget::onColor(uint32_t color) {
+    if (!obj_) return *this;
+    dataOf(obj_)->on_color_ = color;
+    dataOf(obj_)->applyState();
+    return *this;
+}
+
+ButtonWidget& ButtonWidget::textOffColor(uint32_t color) {
+    if (!obj_) return *this;
+    dataOf(obj_)->text_off_color_ = color;
+    dataOf(obj_)->applyState();
+    return *this;
+}
+
+ButtonWidget& ButtonWidget::textOnColor(uint32_t color) {
+    if (!obj_) return *this;
+    dataOf(obj_)->text_on_color_ = color;
+    dataOf(obj_)->applyState();
+    return *this;
+}
+
+ButtonWidget& ButtonWidget::sizeMode(SizeMode mode) {
+    if (!obj_) return *this;
+    dataOf(obj_)->size_policy_.mode = mode;
+    dataOf(obj_)->updateGeometry();
+    return *this;
+}
+
+ButtonWidget& ButtonWidget::padding(float ratio) {
+    if (!obj_) return *this;
+    dataOf(obj_)->padding_ratio_ = std::clamp(ratio, 0.0f, 0.5f);
+    dataOf(obj_)->updateGeometry();
+    return *this;
+}
+
+void ButtonWidget::setState(bool on) {
+    OC_UI_STAT(Button, SetterCalls);
+    if (!obj_) return;
+    ButtonData* button = dataOf(obj_);
+    if (button->is_on_ == on) return;
+    OC_UI_STAT(Button, SetterChanges);
+    button->is_on_ = on;
+    if (button->deferIfHidden()) return;
+    button->applyState();
+}
+
+bool ButtonWidget::getState() const {
+    return obj_ && dataOf(obj_)->is_on_;
+}
+
+void ButtonWidget::setText(const char* text) {
+    if (obj_) dataOf(obj_)->setText(text);
+}
+
+const char* ButtonWidget::getText() const {
+    const ButtonData* button = obj_ ? dataOf(obj_) : nullptr;
+    return button && button->state_label_ ? lv_label_get_text(button->state_label_) : "";
+}
+
+// ============================================================================
+// ButtonData
+// ============================================================================
+
+ButtonData::~ButtonData() {
+    if (init_timer_) lv_timer_delete(init_timer_);
+    if (deferred_) deferred::cancel(container_);
+}
+
+// Hidden: only is_on_ was updated, colors follow once visible
+bool ButtonData::deferIfHidden() {
+    if (!deferred::isHidden(container_)) return false;
+    if (deferred_) return true;
+    deferred_ = deferred::defer(container_, [](void* obj) {
+        ButtonData* button = dataOf(obj);
+        button->deferred_ = false;
+        button->applyState();
+    }, container_);
+    if (deferred_) OC_UI_STAT(Button, Deferred);
+    return deferred_;
 }
 
-void ButtonWidget::createUI() {
+void ButtonData::createUI() {
     // Container setup - transparent, no padding
-    lv_obj_set_style_bg_opa(container_, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(container_, 0, 0);
-    lv_obj_set_style_pad_all(container_, 0, 0);
-    lv_obj_set_style_pad_row(container_, 0, 0);
-    lv_obj_set_style_pad_column(container_, 0, 0);
-    lv_obj_set_scrollbar_mode(container_, LV_SCROLLBAR_MODE_OFF);
+    lean::strip(container_);
     lv_obj_add_flag(container_, LV_OBJ_FLAG_EVENT_BUBBLE);
 
     // Button box (centered, rounded)
-    button_box_ = lv_obj_create(container_);
+    button_box_ = lean::create(container_);
     lv_obj_center(button_box_);
-    lv_obj_set_style_border_width(button_box_, 0, 0);
     lv_obj_set_style_bg_opa(button_box_, LV_OPA_COVER, 0);
-    lv_obj_set_style_pad_all(button_box_, 0, 0);
-    lv_obj_set_scrollbar_mode(button_box_, LV_SCROLLBAR_MODE_OFF);
     lv_obj_add_flag(button_box_, LV_OBJ_FLAG_EVENT_BUBBLE);
 
     applyState();
 
-    // Listen for own size changes
-    lv_obj_add_event_cb(container_, sizeChangedCallback, LV_EVENT_SIZE_CHANGED, this);
-
-    // Defer initial geometry calculation
-    lv_timer_t* init_timer = lv_timer_create([](lv_timer_t* t) {
-        auto* widget = static_cast<ButtonWidget*>(lv_timer_get_user_data(t));
-        if (widget) widget->updateGeometry();
-    }, 0, this);
-    lv_timer_set_repeat_count(init_timer, 1);
-}
-
-void ButtonWidget::sizeChangedCallback(lv_event_t* e) {
-    auto* widget = static_cast<ButtonWidget*>(lv_event_get_user_data(e));
-    if (widget) {
+    // Defer initial geometry calculation (later size changes arrive through eventCallback)
+    init_timer_ = lv_timer_create([](lv_timer_t* t) {
+        ButtonData* widget = dataOf(lv_timer_get_user_data(t));
+        widget->init_timer_ = nullptr;  // One-shot: LVGL deletes it after this call
         widget->updateGeometry();
-    }
+    }, 0, container_);
+    lv_timer_set_repeat_count(init_timer_, 1);
+    OC_UI_STAT(Button, Timers);
 }
 
-void ButtonWidget::updateGeometry() {
-    if (!container_) return;
+void ButtonData::updateGeometry() {
+    if (!button_box_) return;
+    OC_UI_STAT(Button, Geometry);
 
     // Compute size using policy
     auto result = size_policy_.compute(container_);
@@ -134,7 +281,7 @@ void ButtonWidget::updateGeometry() {
     lv_obj_set_style_radius(button_box_, radius, 0);
 }
 
-void ButtonWidget::applyState() {
+void ButtonData::applyState() {
     uint32_t bg_default_off = base_theme::color::INACTIVE;
     uint32_t bg_default_on = base_theme::color::ACTIVE;
     uint32_t text_default_off = base_theme::color::TEXT_PRIMARY;
@@ -154,56 +301,23 @@ void ButtonWidget::applyState() {
     }
 }
 
-// Fluent setters
-ButtonWidget& ButtonWidget::offColor(uint32_t color) {
-    off_color_ = color;
-    applyState();
-    return *this;
-}
-
-ButtonWidget& ButtonWidget::onColor(uint32_t color) {
-    on_color_ = color;
-    applyState();
-    return *this;
-}
-
-ButtonWidget& ButtonWidget::textOffColor(uint32_t color) {
-    text_off_color_ = color;
-    applyState();
-    return *this;
-}
-
-ButtonWidget& ButtonWidget::textOnColor(uint32_t color) {
-    text_on_color_ = color;
-    applyState();
-    return *this;
-}
-
-ButtonWidget& ButtonWidget::sizeMode(SizeMode mode) {
-    size_policy_.mode = mode;
-    updateGeometry();
-    return *this;
-}
-
-ButtonWidget& ButtonWidget::padding(float ratio) {
-    padding_ratio_ = std::clamp(ratio, 0.0f, 0.5f);
-    updateGeometry();
-    return *this;
-}
-
-void ButtonWidget::setState(bool on) {
-    if (is_on_ == on) return;
-    is_on_ = on;
-    applyState();
-}
-
-void ButtonWidget::setText(const char* text) {
+void ButtonData::setText(const char* text) {
+    OC_UI_STAT(Button, SetterCalls);
+#if OC_UI_LVGL_STATS
+    const char* current = state_label_ ? lv_label_get_text(state_label_) : nullptr;
+    if (!current || !text || std::strcmp(current, text) != 0) OC_UI_STAT(Button, SetterChanges);
+#endif
     if (!state_label_) {
         state_label_ = lv_label_create(button_box_);
         lv_obj_center(state_label_);
         lv_obj_set_style_text_align(state_label_, LV_TEXT_ALIGN_CENTER, 0);
     }
+#if OC_UI_LVGL_STATIC_ALLOC
+    std::strncpy(text_, text ? text : "", sizeof(text_) - 1);
+    lv_label_set_text_static(state_label_, text_);
+#else
     lv_label_set_text(state_label_, text);
+#endif
     applyState();  // Apply text color
 }
 
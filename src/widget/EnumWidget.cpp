@@ -1,132 +1,239 @@
 #include <oc/ui/lvgl/widget/EnumWidget.hpp>
 
 #include <algorithm>
+#include <new>
 #include <utility>
 
+#include <lvgl_private.h>  // lv_obj_class_t layout
+
+#include <oc/ui/lvgl/Deferred.hpp>
+#include <oc/ui/lvgl/LeanObject.hpp>
+#include <oc/ui/lvgl/Stats.hpp>
+
 namespace oc::ui::lvgl {
 
-EnumWidget::EnumWidget(lv_obj_t* parent) {
-    container_ = lv_obj_create(parent);
-    createUI();
+namespace {
+
+/**
+ * Enum widget state, stored in the object's own allocation (see
+ * EnumObject). Timers and the class event callback reach it through the
+ * object, so nothing in LVGL points at the EnumWidget handle.
+ */
+struct EnumData {
+    static constexpr uint16_t DEFAULT_WIDTH = 62;
+    static constexpr lv_coord_t LINE_HEIGHT = 2;
+    static constexpr lv_coord_t LINE_MARGIN = 4;
+    static constexpr lv_coord_t LINE_TOP_MARGIN = 2;
+    static constexpr lv_coord_t LINE_BOTTOM_MARGIN = 2;
+    static constexpr lv_coord_t INNER_HEIGHT = 40;
+
+    explicit EnumData(lv_obj_t* obj) : container_(obj) {}
+    ~EnumData();
+
+    void createUI(bool lean);
+    void applyColors();
+    void updateGeometry();
+    void triggerFlash();
+    void createFlashTimer();
+    static void flashTimerCallback(lv_timer_t* timer);
+
+    // LVGL objects (children are deleted by LVGL before ~EnumData runs)
+    lv_obj_t* container_;
+    lv_obj_t* inner_ = nullptr;
+    lv_obj_t* top_line_ = nullptr;
+    lv_timer_t* init_timer_ = nullptr;   // Deferred first geometry
+    lv_timer_t* flash_timer_ = nullptr;  // Paused between flashes
+
+    // Configuration
+    uint32_t bg_color_ = 0;
+    uint32_t line_color_ = 0;
+    uint32_t flash_color_ = 0;
+    bool lean_ = false;  // ObjectTree::Lean: inner_ == container_
+
+    // Size policy
+    SquareSizePolicy size_policy_;
+};
+
+/** Enum widget instance: LVGL's base object followed by the widget state */
+struct EnumObject {
+    lv_obj_t obj;
+    EnumData data;
+};
+
+EnumData* dataOf(void* obj) {
+    return &static_cast<EnumObject*>(obj)->data;
+}
+
+void constructorCallback(const lv_obj_class_t*, lv_obj_t* obj) {
+    new (dataOf(obj)) EnumData(obj);
+}
+
+void destructorCallback(const lv_obj_class_t*, lv_obj_t* obj) {
+    dataOf(obj)->~EnumData();
+}
+
+void eventCallback(const lv_obj_class_t*, lv_event_t* e) {
+    if (lv_obj_event_base(EnumWidget::objClass(), e) != LV_RESULT_OK) return;
+    if (lv_event_get_code(e) == LV_EVENT_SIZE_CHANGED) {
+        dataOf(lv_event_get_current_target_obj(e))->updateGeometry();
+    }
+}
+
+}  // namespace
+
+// ============================================================================
+// EnumWidget (handle)
+// ============================================================================
+
+const lv_obj_class_t* EnumWidget::objClass() {
+    static const lv_obj_class_t cls = [] {
+        lv_obj_class_t c{};
+        c.base_class = &lv_obj_class;
+        c.constructor_cb = constructorCallback;
+        c.destructor_cb = destructorCallback;
+        c.event_cb = eventCallback;
+        c.name = "oc_enum";
+        c.width_def = LV_DPI_DEF;
+        c.height_def = LV_DPI_DEF;
+        c.instance_size = sizeof(EnumObject);
+        c.theme_inheritable = LV_OBJ_CLASS_THEME_INHERITABLE_TRUE;
+        return c;
+    }();
+    return &cls;
+}
+
+EnumWidget::EnumWidget(lv_obj_t* parent, ObjectTree tree) {
+    obj_ = lv_obj_class_create_obj(objClass(), parent);
+    lv_obj_class_init_obj(obj_);
+    dataOf(obj_)->createUI(tree == ObjectTree::Lean);
 }
 
 EnumWidget::~EnumWidget() {
-    cleanup();
+    if (obj_) lv_obj_delete(obj_);
 }
 
-EnumWidget::EnumWidget(EnumWidget&& other) noexcept
-    : container_(other.container_),
-      inner_(other.inner_),
-      top_line_(other.top_line_),
-      flash_timer_(other.flash_timer_),
-      bg_color_(other.bg_color_),
-      line_color_(other.line_color_),
-      flash_color_(other.flash_color_),
-      size_policy_(other.size_policy_) {
-    other.container_ = nullptr;
-    other.inner_ = nullptr;
-    other.top_line_ = nullptr;
-    other.flash_timer_ = nullptr;
+EnumWidget::EnumWidget(EnumWidget&& other) noexcept : obj_(other.obj_) {
+    other.obj_ = nullptr;
 }
 
 EnumWidget& EnumWidget::operator=(EnumWidget&& other) noexcept {
     if (this != &other) {
-        cleanup();
-
-        container_ = other.container_;
-        inner_ = other.inner_;
-        top_line_ = other.top_line_;
-        flash_timer_ = other.flash_timer_;
-        bg_color_ = other.bg_color_;
-        line_color_ = other.line_color_;
-        flash_color_ = other.flash_color_;
-        size_policy_ = other.size_policy_;
-
-        other.container_ = nullptr;
-        other.inner_ = nullptr;
-        other.top_line_ = nullptr;
-        other.flash_timer_ = nullptr;
+        if (obj_) lv_obj_delete(obj_);
+        obj_ = other.obj_;
+        other.obj_ = nullptr;
     }
     return *this;
 }
 
-void EnumWidget::cleanup() {
-    if (flash_timer_) {
-        lv_timer_delete(flash_timer_);
-        flash_timer_ = nullptr;
-    }
-    if (container_) {
-        lv_obj_delete(container_);
-        container_ = nullptr;
-    }
-    inner_ = nullptr;
-    top_line_ = nullptr;
+lv_obj_t* EnumWidget::inner() const {
+    return obj_ ? dataOf(obj_)->inner_ : nullptr;
+}
+
+EnumWidget& EnumWidget::sizeMode(SizeMode mode) {
+    if (!obj_) return *this;
+    dataOf(obj_)->size_policy_.mode = mode;
+    dataOf(obj_)->updateGeometry();
+    return *this;
 }
 
-void EnumWidget::createUI() {
+// Fluent setters
+EnumWidget& EnumWidget::bgColor(uint32_t color) & {
+    if (!obj_) return *this;
+    dataOf(obj_)->bg_color_ = color;
+    dataOf(obj_)->applyColors();
+    return *this;
+}
+
+EnumWidget EnumWidget::bgColor(uint32_t color) && {
+    return std::move(bgColor(color));
+}
+
+EnumWidget& EnumWidget::lineColor(uint32_t color) & {
+    if (!obj_) return *this;
+    dataOf(obj_)->line_color_ = color;
+    dataOf(obj_)->applyColors();
+    return *this;
+}
+
+EnumWidget EnumWidget::lineColor(uint32_t color) && {
+    return std::move(lineColor(color));
+}
+
+EnumWidget& EnumWidget::flashColor(uint32_t color) & {
+    if (obj_) dataOf(obj_)->flash_color_ = color;
+    return *this;
+}
+
+EnumWidget EnumWidget::flashColor(uint32_t color) && {
+    return std::move(flashColor(color));
+}
+
+void EnumWidget::triggerFlash() {
+    if (obj_) dataOf(obj_)->triggerFlash();
+}
+
+// ============================================================================
+// EnumData
+// ============================================================================
+
+// Runs from lv_obj_delete() after the children are gone
+EnumData::~EnumData() {
+    if (init_timer_) lv_timer_delete(init_timer_);
+    if (flash_timer_) lv_timer_delete(flash_timer_);
+}
+
+void EnumData::createUI(bool lean) {
+    lean_ = lean;
+
     // Container setup - transparent, no padding
-    lv_obj_set_style_bg_opa(container_, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(container_, 0, 0);
-    lv_obj_set_style_pad_all(container_, 0, 0);
-    lv_obj_set_scrollbar_mode(container_, LV_SCROLLBAR_MODE_OFF);
+    lean::strip(container_);
     lv_obj_add_flag(container_, LV_OBJ_FLAG_EVENT_BUBBLE);
 
     // Inner area - flex column, centered in container
     // Contains: line (top) + content area (where consumer adds label)
-    inner_ = lv_obj_create(container_);
-    lv_obj_set_style_bg_opa(inner_, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(inner_, 0, 0);
-    lv_obj_set_style_pad_all(inner_, 0, 0);
+    // Lean: the container is the column, side padding narrows it to the line
+    inner_ = lean_ ? container_ : lean::create(container_);
+    if (!lean_) {
+        lv_obj_add_flag(inner_, LV_OBJ_FLAG_EVENT_BUBBLE);
+        lv_obj_center(inner_);
+    }
     lv_obj_set_style_pad_row(inner_, LINE_BOTTOM_MARGIN, 0);  // Gap between line and content
-    lv_obj_set_scrollbar_mode(inner_, LV_SCROLLBAR_MODE_OFF);
-    lv_obj_add_flag(inner_, LV_OBJ_FLAG_EVENT_BUBBLE);
     lv_obj_set_flex_flow(inner_, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_flex_align(inner_, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    lv_obj_center(inner_);
 
-    // Indicator line - first child of inner_ (will be above content)
-    top_line_ = lv_obj_create(inner_);
+    // Indicator line - first child of inner_ (will be above content), not clickable
+    top_line_ = lean::create(inner_);
     lv_obj_set_style_bg_opa(top_line_, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_width(top_line_, 0, 0);
-    lv_obj_set_style_radius(top_line_, 0, 0);
-    lv_obj_add_flag(top_line_, LV_OBJ_FLAG_EVENT_BUBBLE);
-    lv_obj_set_scrollbar_mode(top_line_, LV_SCROLLBAR_MODE_OFF);
 
     applyColors();
 
-    // Listen for own size changes
-    lv_obj_add_event_cb(container_, sizeChangedCallback, LV_EVENT_SIZE_CHANGED, this);
+    // Defer initial geometry calculation (later size changes arrive through eventCallback)
+    init_timer_ = lv_timer_create([](lv_timer_t* t) {
+        EnumData* widget = dataOf(lv_timer_get_user_data(t));
+        widget->init_timer_ = nullptr;  // One-shot: LVGL deletes it after this call
+        widget->updateGeometry();
+    }, 0, container_);
+    lv_timer_set_repeat_count(init_timer_, 1);
+    OC_UI_STAT(Enum, Timers);
 
-    // Defer initial geometry calculation
-    lv_timer_t* init_timer = lv_timer_create([](lv_timer_t* t) {
-        auto* widget = static_cast<EnumWidget*>(lv_timer_get_user_data(t));
-        if (widget) widget->updateGeometry();
-    }, 0, this);
-    lv_timer_set_repeat_count(init_timer, 1);
+#if OC_UI_LVGL_STATIC_ALLOC
+    createFlashTimer();
+#endif
 }
 
-void EnumWidget::applyColors() {
+void EnumData::applyColors() {
     uint32_t bg = bg_color_ != 0 ? bg_color_ : base_theme::color::BACKGROUND;
     uint32_t line = line_color_ != 0 ? line_color_ : base_theme::color::INACTIVE;
 
-    if (container_) {
-        lv_obj_set_style_bg_color(container_, lv_color_hex(bg), 0);
-        lv_obj_set_style_bg_opa(container_, bg_color_ != 0 ? LV_OPA_COVER : LV_OPA_TRANSP, 0);
-    }
+    lv_obj_set_style_bg_color(container_, lv_color_hex(bg), 0);
+    lv_obj_set_style_bg_opa(container_, bg_color_ != 0 ? LV_OPA_COVER : LV_OPA_TRANSP, 0);
     if (top_line_) {
         lv_obj_set_style_bg_color(top_line_, lv_color_hex(line), 0);
     }
 }
 
-void EnumWidget::sizeChangedCallback(lv_event_t* e) {
-    auto* widget = static_cast<EnumWidget*>(lv_event_get_user_data(e));
-    if (widget) {
-        widget->updateGeometry();
-    }
-}
-
-void EnumWidget::updateGeometry() {
-    if (!container_) return;
+void EnumData::updateGeometry() {
+    OC_UI_STAT(Enum, Geometry);
 
     // Compute size using policy
     auto result = size_policy_.compute(container_);
@@ -152,6 +259,14 @@ void EnumWidget::updateGeometry() {
         lv_obj_set_size(top_line_, line_width, LINE_HEIGHT);
     }
 
+    // Lean: the container is the column, its content width is the line width
+    if (lean_) {
+        lv_coord_t side = (result.width - line_width) / 2;
+        lv_obj_set_style_pad_left(container_, side, 0);
+        lv_obj_set_style_pad_right(container_, side, 0);
+        return;
+    }
+
     // Inner uses content sizing - flex handles layout
     // Width is constrained to line width for alignment
     if (inner_) {
@@ -161,64 +276,33 @@ void EnumWidget::updateGeometry() {
     }
 }
 
-EnumWidget& EnumWidget::sizeMode(SizeMode mode) {
-    size_policy_.mode = mode;
-    updateGeometry();
-    return *this;
-}
-
-// Fluent setters
-EnumWidget& EnumWidget::bgColor(uint32_t color) & {
-    bg_color_ = color;
-    applyColors();
-    return *this;
-}
-
-EnumWidget EnumWidget::bgColor(uint32_t color) && {
-    return std::move(bgColor(color));
-}
-
-EnumWidget& EnumWidget::lineColor(uint32_t color) & {
-    line_color_ = color;
-    applyColors();
-    return *this;
-}
-
-EnumWidget EnumWidget::lineColor(uint32_t color) && {
-    return std::move(lineColor(color));
-}
-
-EnumWidget& EnumWidget::flashColor(uint32_t color) & {
-    flash_color_ = color;
-    return *this;
-}
-
-EnumWidget EnumWidget::flashColor(uint32_t color) && {
-    return std::move(flashColor(color));
-}
-
-void EnumWidget::triggerFlash() {
-    if (!top_line_) return;
-
-    if (flash_timer_) {
-        lv_timer_delete(flash_timer_);
-        flash_timer_ = nullptr;
-    }
+void EnumData::triggerFlash() {
+    // Nobody would see it: no restyle, no timer
+    if (!top_line_ || deferred::isHidden(container_)) return;
+    OC_UI_STAT(Enum, Flashes);
 
     uint32_t flash = flash_color_ != 0 ? flash_color_ : base_theme::color::ACTIVE;
     lv_obj_set_style_bg_color(top_line_, lv_color_hex(flash), 0);
 
-    flash_timer_ = lv_timer_create(flashTimerCallback, base_theme::animation::FLASH_DURATION_MS, this);
-    lv_timer_set_repeat_count(flash_timer_, 1);
+    // Restart the existing timer: a new flash extends the current one
+    if (!flash_timer_) createFlashTimer();
+    lv_timer_reset(flash_timer_);
+    lv_timer_resume(flash_timer_);
+}
+
+void EnumData::createFlashTimer() {
+    flash_timer_ = lv_timer_create(flashTimerCallback, base_theme::animation::FLASH_DURATION_MS, container_);
+    lv_timer_pause(flash_timer_);
+    OC_UI_STAT(Enum, Timers);
 }
 
-void EnumWidget::flashTimerCallback(lv_timer_t* timer) {
-    auto* widget = static_cast<EnumWidget*>(lv_timer_get_user_data(timer));
-    if (!widget || !widget->top_line_) return;
+void EnumData::flashTimerCallback(lv_timer_t* timer) {
+    lv_timer_pause(timer);  // Kept for the next flash
+    EnumData* widget = dataOf(lv_timer_get_user_data(timer));
+    if (!widget->top_line_) return;
 
     uint32_t line = widget->line_color_ != 0 ? widget->line_color_ : base_theme::color::INACTIVE;
     lv_obj_set_style_bg_color(widget->top_line_, lv_color_hex(line), 0);
-    widget->flash_timer_ = nullptr;
 }
 
 }  // namespace oc::ui::lvgl
@@ -0,0 +1,128 @@
+#include <oc/ui/lvgl/widget/KnobBank.hpp>
+
+#include <algorithm>
+
+#include <oc/ui/lvgl/Trace.hpp>
+#include <oc/ui/lvgl/widget/KnobAngleTable.hpp>
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+// Bits of the change mask
+constexpr uint8_t VALUE_CHANGED = 1;
+constexpr uint8_t ORIGIN_CHANGED = 2;
+constexpr uint8_t RIBBON_CHANGED = 4;
+
+// max/min map NaN to 0 and compile to plain min/max instructions, so the
+// commit loop vectorizes
+inline float clamp01(float value) {
+    return std::max(0.0f, std::min(value, 1.0f));
+}
+
+// knob_angle::index() without branches
+inline uint16_t angleIndex(float value) {
+    return static_cast<uint16_t>(clamp01(value) * knob_angle::STEP_COUNT + 0.5f);
+}
+
+}  // namespace
+
+void KnobBank::reserve(size_t count) {
+    knobs_.reserve(count);
+    values_.reserve(count);
+    origins_.reserve(count);
+    ribbon_values_.reserve(count);
+    ribbon_on_.reserve(count);
+    value_idx_.reserve(count);
+    origin_idx_.reserve(count);
+    ribbon_idx_.reserve(count);
+    changed_.reserve(count);
+}
+
+KnobWidget& KnobBank::add(lv_obj_t* parent) {
+    // Arrays start at the knob's own defaults: nothing to apply
+    knobs_.emplace_back(parent);
+    values_.push_back(0.0f);
+    origins_.push_back(0.0f);
+    ribbon_values_.push_back(0.0f);
+    ribbon_on_.push_back(0);
+    value_idx_.push_back(0);
+    origin_idx_.push_back(0);
+    ribbon_idx_.push_back(RIBBON_OFF);
+    changed_.push_back(0);
+    return knobs_.back();
+}
+
+void KnobBank::setValues(const float* values, size_t count, size_t first) {
+    if (first >= values_.size()) return;
+    count = std::min(count, values_.size() - first);
+    std::copy(values, values + count, values_.begin() + static_cast<ptrdiff_t>(first));
+}
+
+void KnobBank::setRibbonValue(size_t i, float value) {
+    ribbon_values_[i] = value;
+    ribbon_on_[i] = 1;
+}
+
+void KnobBank::setCentered(size_t i, bool centered) {
+    // centered() may move origin and value: re-seed the arrays from the knob
+    // (drawn by centered() itself) so commit() doesn't undo it
+    KnobWidget& knob = knobs_[i];
+    knob.centered(centered);
+    values_[i] = knob.getValue();
+    origins_[i] = knob.getOrigin();
+    value_idx_[i] = knob_angle::index(values_[i]);
+    origin_idx_[i] = knob_angle::index(origins_[i]);
+}
+
+size_t KnobBank::commit(bool flash) {
+    OC_UI_TRACE_SCOPE("KnobBank::commit");
+
+    const size_t n = knobs_.size();
+    const float* values = values_.data();
+    const float* origins = origins_.data();
+    const float* ribbons = ribbon_values_.data();
+    const uint8_t* ribbon_on = ribbon_on_.data();
+    uint16_t* value_idx = value_idx_.data();
+    uint16_t* origin_idx = origin_idx_.data();
+    uint16_t* ribbon_idx = ribbon_idx_.data();
+    uint8_t* changed = changed_.data();
+
+    // Pass 1: flat arrays in, change mask and new angle indices out
+    size_t changed_count = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint16_t value = angleIndex(values[i]);
+        uint16_t origin = angleIndex(origins[i]);
+        uint16_t ribbon = ribbon_on[i] ? angleIndex(ribbons[i]) : RIBBON_OFF;
+        uint8_t mask = static_cast<uint8_t>((value != value_idx[i] ? VALUE_CHANGED : 0) |
+                                            (origin != origin_idx[i] ? ORIGIN_CHANGED : 0) |
+                                            (ribbon != ribbon_idx[i] ? RIBBON_CHANGED : 0));
+        changed[i] = mask;
+        changed_count += mask != 0;
+        value_idx[i] = value;
+        origin_idx[i] = origin;
+        ribbon_idx[i] = ribbon;
+    }
+    if (changed_count == 0) return 0;
+
+    // Pass 2: LVGL work for the changed knobs only, from the pass 1 indices
+    for (size_t i = 0; i < n; i++) {
+        uint8_t mask = changed[i];
+        if (!mask) continue;
+
+        KnobWidget::BankUpdate update;
+        update.value = clamp01(values[i]);
+        update.origin = clamp01(origins[i]);
+        update.ribbon = clamp01(ribbons[i]);
+        update.value_idx = value_idx[i];
+        update.origin_idx = origin_idx[i];
+        update.ribbon_idx = ribbon_idx[i];
+        update.value_changed = (mask & VALUE_CHANGED) != 0;
+        update.origin_changed = (mask & ORIGIN_CHANGED) != 0;
+        update.ribbon_changed = (mask & RIBBON_CHANGED) != 0;
+        knobs_[i].applyBankUpdate(update, flash);
+    }
+    return changed_count;
+}
+
+}  // namespace oc::ui::lvgl
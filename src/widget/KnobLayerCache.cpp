@@ -0,0 +1,86 @@
+#include <oc/ui/lvgl/widget/KnobLayerCache.hpp>
+
+#include <algorithm>
+
+#include <oc/ui/lvgl/widget/KnobAngleTable.hpp>
+
+namespace oc::ui::lvgl {
+
+std::vector<KnobLayerCache::Entry>& KnobLayerCache::entries() {
+    static std::vector<Entry> cache;
+    return cache;
+}
+
+lv_draw_buf_t* KnobLayerCache::acquire(const Key& key, lv_obj_t* host) {
+    if (key.size <= 0) return nullptr;
+
+    auto& cache = entries();
+    for (auto& entry : cache) {
+        if (entry.key == key) {
+            entry.refs++;
+            return entry.buf;
+        }
+    }
+
+    lv_draw_buf_t* buf = render(key, host);
+    if (!buf) return nullptr;
+    cache.push_back({key, buf, 1});
+    return buf;
+}
+
+void KnobLayerCache::release(lv_draw_buf_t* buf) {
+    if (!buf) return;
+
+    auto& cache = entries();
+    auto it = std::find_if(cache.begin(), cache.end(),
+                           [buf](const Entry& entry) { return entry.buf == buf; });
+    if (it == cache.end()) return;
+    if (--it->refs > 0) return;
+
+    // Drop any decoder cache entry before the memory can be reused
+    lv_image_cache_drop(buf);
+    lv_draw_buf_destroy(buf);
+    cache.erase(it);
+}
+
+lv_draw_buf_t* KnobLayerCache::render(const Key& key, lv_obj_t* host) {
+#if LV_USE_CANVAS
+    auto size = static_cast<uint32_t>(key.size);
+    lv_draw_buf_t* buf = lv_draw_buf_create(size, size, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    if (!buf) return nullptr;
+    lv_draw_buf_clear(buf, nullptr);
+
+    // Scratch canvas: only used to get a layer targeting the buffer
+    lv_obj_t* canvas = lv_canvas_create(host);
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_draw_buf(canvas, buf);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_coord_t center = key.size / 2;
+
+    // Background arc (same geometry as the arc widget's main part)
+    lv_draw_arc_dsc_t arc_dsc;
+    lv_draw_arc_dsc_init(&arc_dsc);
+    arc_dsc.color = lv_color_hex(key.bg_color);
+    arc_dsc.width = key.arc_width;
+    arc_dsc.start_angle = knob_angle::START_DEGREES;
+    arc_dsc.end_angle = knob_angle::END_DEGREES;
+    arc_dsc.center.x = center;
+    arc_dsc.center.y = center;
+    arc_dsc.radius = static_cast<uint16_t>(key.arc_size / 2);
+    arc_dsc.rounded = key.square_caps ? 0 : 1;
+    lv_draw_arc(&layer, &arc_dsc);
+
+    lv_canvas_finish_layer(canvas, &layer);
+    lv_obj_delete(canvas);
+    return buf;
+#else
+    (void)key;
+    (void)host;
+    return nullptr;
+#endif
+}
+
+}  // namespace oc::ui::lvgl
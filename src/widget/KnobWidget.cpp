@@ -2,121 +2,462 @@
 
 #include <algorithm>
 #include <cmath>
+#include <memory>
+#include <new>
+
+#include <lvgl_private.h>  // lv_obj_class_t layout
+
+#include <oc/ui/lvgl/Deferred.hpp>
+#include <oc/ui/lvgl/LeanObject.hpp>
+#include <oc/ui/lvgl/Stats.hpp>
+#include <oc/ui/lvgl/Trace.hpp>
+#include <oc/ui/lvgl/widget/KnobAngleTable.hpp>
+#include <oc/ui/lvgl/widget/KnobLayerCache.hpp>
 
 namespace oc::ui::lvgl {
 
+namespace {
+
+/**
+ * Suspends display invalidation so the knob can invalidate precise areas itself.
+ * Nested use is safe: only the outermost scope re-enables invalidation.
+ */
+class ScopedInvalidationOff {
+public:
+    explicit ScopedInvalidationOff(lv_obj_t* obj) : disp_(lv_obj_get_display(obj)) {
+        if (disp_ && lv_display_is_invalidation_enabled(disp_)) {
+            lv_display_enable_invalidation(disp_, false);
+        } else {
+            disp_ = nullptr;
+        }
+    }
+    ~ScopedInvalidationOff() {
+        if (disp_) lv_display_enable_invalidation(disp_, true);
+    }
+
+    ScopedInvalidationOff(const ScopedInvalidationOff&) = delete;
+    ScopedInvalidationOff& operator=(const ScopedInvalidationOff&) = delete;
+
+private:
+    lv_display_t* disp_;
+};
+
+constexpr uint16_t degreesToIndex(int16_t deg) {
+    return static_cast<uint16_t>((deg - knob_angle::START_DEGREES) * knob_angle::STEPS_PER_DEGREE);
+}
+
+/**
+ * Knob state, stored in the knob object's own allocation (see KnobObject).
+ * Timers and the class event callback reach it through the object, so
+ * nothing in LVGL points at the KnobWidget handle.
+ */
+struct KnobData {
+    // Fixed proportions (relative to knob size)
+    static constexpr uint16_t MIN_SIZE = 30;
+    static constexpr uint32_t FLASH_RATE_LIMIT_MS = 80;    // Min interval between flashes
+    static constexpr float ARC_WIDTH_RATIO = 0.13f;        // Arc width as ratio of size
+    static constexpr float INDICATOR_RATIO = 0.13f;        // Indicator thickness ratio
+    static constexpr float CENTER_CIRCLE_RATIO = 0.22f;    // Center circle size ratio
+    static constexpr float INNER_CIRCLE_RATIO = 0.10f;     // Inner circle size ratio
+    static constexpr float FALLBACK_VALUE_EPSILON = 0.001f; // Before geometry is known
+    static constexpr lv_coord_t LOD_NO_INNER_BELOW = 40;     // Inner circle barely visible below
+    static constexpr lv_coord_t LOD_NO_INDICATOR_BELOW = 34; // Indicator as wide as the arc below
+    static constexpr float SWEEP_RADIANS = knob_angle::SWEEP_DEGREES * 3.14159265f / 180.0f;
+    static constexpr int16_t START_ANGLE = knob_angle::START_DEGREES;
+    static constexpr int16_t END_ANGLE = knob_angle::END_DEGREES;
+
+    explicit KnobData(lv_obj_t* obj) : container_(obj) {}
+    ~KnobData();
+
+    void createUI();
+    void createArc();
+    void createRibbon();
+    void createIndicator();
+    void createCenterCircles();
+    void applyColors();
+    void applyRibbonColors();
+    void updateGeometry();
+    void updateArc();
+    void updateArcAt(uint16_t value_idx, uint16_t origin_idx);
+    void updateRibbon();
+    void updateRibbonAt(uint16_t low_idx, uint16_t high_idx);
+    void showRibbon();
+    void invalidateSweep(int16_t fromDeg, int16_t toDeg);
+    void invalidateIndicator(const lv_point_precise_t& pivot, const lv_point_precise_t& tip);
+    void resetAppliedGeometry();
+    float valueEpsilon() const;
+    void refreshStaticLayer();
+    void releaseStaticLayer();
+    void setLiveStaticParts(bool live);
+    KnobLod lodFor(float size) const;
+    void applyLod(KnobLod lod);
+    void setValue(float value, bool flash);
+    void setRibbonValue(float value);
+    void setRibbonSpan(float from, float to);
+    void setRibbonEnabled(bool enabled);
+    bool deferIfHidden();
+    void applyDeferred();
+    void triggerFlash();
+    void createFlashTimer();
+    void drainRibbonFeed();
+    static void ribbonFrameCallback(lv_timer_t* timer);
+    static void flashTimerCallback(lv_timer_t* timer);
+
+    // LVGL objects (children are deleted by LVGL before ~KnobData runs)
+    lv_obj_t* container_;
+    lv_obj_t* arc_ = nullptr;
+    lv_obj_t* ribbon_arc_ = nullptr;
+    lv_obj_t* indicator_ = nullptr;
+    lv_obj_t* center_circle_ = nullptr;
+    lv_obj_t* inner_circle_ = nullptr;
+    lv_obj_t* static_layer_ = nullptr;  // Cached background arc (staticLayerCache mode)
+    lv_timer_t* init_timer_ = nullptr;    // Deferred first geometry
+    lv_timer_t* flash_timer_ = nullptr;   // Paused between flashes
+    lv_timer_t* ribbon_timer_ = nullptr;  // Per-frame feed reduction
+
+    // Indicator line points
+    lv_point_precise_t line_points_[2];
+
+    // Configuration
+    uint32_t bg_color_ = 0;
+    uint32_t track_color_ = 0;
+    uint32_t value_color_ = 0;
+    uint32_t flash_color_ = 0;
+
+    // Ribbon configuration
+    uint32_t ribbon_color_ = 0;
+    lv_opa_t ribbon_opa_ = LV_OPA_COVER;
+    float ribbon_thickness_ratio_ = 0.8f;
+    RibbonMode ribbon_mode_ = RibbonMode::Latest;
+    uint32_t ribbon_smoothing_ms_ = 60;  // One-pole time constant
+
+    // State
+    float value_ = 0.0f;
+    float origin_ = 0.0f;
+    float ribbon_value_ = 0.0f;
+    float ribbon_low_ = 0.0f;    // Span mode endpoints
+    float ribbon_high_ = 0.0f;
+    bool ribbon_span_ = false;   // Ribbon shows low..high instead of value..ribbon_value
+    bool centered_ = false;
+    bool ribbon_enabled_ = false;
+    uint32_t last_flash_ms_ = 0;
+    bool static_layer_enabled_ = false;
+    bool deferred_ = false;  // Model changed while hidden, queued in deferred::
+    float drawn_value_ = -1.0f;         // value_ at the last redraw (epsilon reference)
+    float drawn_ribbon_value_ = -1.0f;  // ribbon_value_ at the last redraw
+
+    // Level of detail (sizes below which each level applies, 0 = never)
+    KnobLod lod_ = KnobLod::Full;
+    lv_coord_t lod_no_inner_below_ = LOD_NO_INNER_BELOW;
+    lv_coord_t lod_no_indicator_below_ = LOD_NO_INDICATOR_BELOW;
+    lv_coord_t lod_square_caps_below_ = 0;
+
+    // Ribbon feed (samples pushed from any thread, reduced per frame)
+    std::unique_ptr<RibbonFeed> ribbon_feed_;
+    float ribbon_target_ = 0.0f;
+    bool ribbon_smoothed_valid_ = false;
+    uint32_t ribbon_drain_ms_ = 0;
+
+    // Size policy
+    SquareSizePolicy size_policy_;
+
+    // Cached geometry (computed from actual size) - all float for precision
+    float knob_size_ = 0.0f;
+    float arc_radius_ = 0.0f;
+    float indicator_thickness_ = 0.0f;
+    float center_x_ = 0.0f;  // container width / 2
+    float center_y_ = 0.0f;  // container height / 2
+    KnobLayerCache::Key layer_geometry_;  // Background arc geometry (color unset)
+
+    // Static layer currently shown (nullptr = parts drawn live)
+    lv_draw_buf_t* static_layer_buf_ = nullptr;
+    KnobLayerCache::Key static_layer_key_;
+
+    // Last state pushed to LVGL (quantized) - unchanged values skip all LVGL calls
+    int16_t applied_arc_start_ = -1;
+    int16_t applied_arc_end_ = -1;
+    int16_t applied_ribbon_start_ = -1;
+    int16_t applied_ribbon_end_ = -1;
+    lv_coord_t applied_tip_x_ = -1;
+    lv_coord_t applied_tip_y_ = -1;
+};
+
+/** Knob instance: LVGL's base object followed by the knob state */
+struct KnobObject {
+    lv_obj_t obj;
+    KnobData data;
+};
+static_assert(sizeof(KnobObject) < (1u << 16), "lv_obj_class_t::instance_size is 16 bits");
+
+KnobData* dataOf(void* obj) {
+    return &static_cast<KnobObject*>(obj)->data;
+}
+
+void constructorCallback(const lv_obj_class_t*, lv_obj_t* obj) {
+    new (dataOf(obj)) KnobData(obj);
+}
+
+void destructorCallback(const lv_obj_class_t*, lv_obj_t* obj) {
+    dataOf(obj)->~KnobData();
+}
+
+void eventCallback(const lv_obj_class_t*, lv_event_t* e) {
+    if (lv_obj_event_base(KnobWidget::objClass(), e) != LV_RESULT_OK) return;
+    if (lv_event_get_code(e) == LV_EVENT_SIZE_CHANGED) {
+        dataOf(lv_event_get_current_target_obj(e))->updateGeometry();
+    }
+}
+
+}  // namespace
+
+// ============================================================================
+// KnobWidget (handle)
+// ============================================================================
+
+const lv_obj_class_t* KnobWidget::objClass() {
+    static const lv_obj_class_t cls = [] {
+        lv_obj_class_t c{};
+        c.base_class = &lv_obj_class;
+        c.constructor_cb = constructorCallback;
+        c.destructor_cb = destructorCallback;
+        c.event_cb = eventCallback;
+        c.name = "oc_knob";
+        c.width_def = LV_DPI_DEF;
+        c.height_def = LV_DPI_DEF;
+        c.instance_size = sizeof(KnobObject);
+        c.theme_inheritable = LV_OBJ_CLASS_THEME_INHERITABLE_TRUE;
+        return c;
+    }();
+    return &cls;
+}
+
 KnobWidget::KnobWidget(lv_obj_t* parent) {
-    container_ = lv_obj_create(parent);
-    createUI();
+    obj_ = lv_obj_class_create_obj(objClass(), parent);
+    lv_obj_class_init_obj(obj_);
+    dataOf(obj_)->createUI();
 }
 
 KnobWidget::~KnobWidget() {
-    cleanup();
-}
-
-KnobWidget::KnobWidget(KnobWidget&& other) noexcept
-    : container_(other.container_),
-      arc_(other.arc_),
-      ribbon_arc_(other.ribbon_arc_),
-      indicator_(other.indicator_),
-      center_circle_(other.center_circle_),
-      inner_circle_(other.inner_circle_),
-      flash_timer_(other.flash_timer_),
-      bg_color_(other.bg_color_),
-      track_color_(other.track_color_),
-      value_color_(other.value_color_),
-      flash_color_(other.flash_color_),
-      ribbon_color_(other.ribbon_color_),
-      ribbon_opa_(other.ribbon_opa_),
-      ribbon_thickness_ratio_(other.ribbon_thickness_ratio_),
-      value_(other.value_),
-      origin_(other.origin_),
-      ribbon_value_(other.ribbon_value_),
-      centered_(other.centered_),
-      ribbon_enabled_(other.ribbon_enabled_),
-      size_policy_(other.size_policy_),
-      knob_size_(other.knob_size_),
-      arc_radius_(other.arc_radius_),
-      indicator_thickness_(other.indicator_thickness_),
-      center_x_(other.center_x_),
-      center_y_(other.center_y_) {
-    line_points_[0] = other.line_points_[0];
-    line_points_[1] = other.line_points_[1];
-    other.container_ = nullptr;
-    other.arc_ = nullptr;
-    other.ribbon_arc_ = nullptr;
-    other.indicator_ = nullptr;
-    other.center_circle_ = nullptr;
-    other.inner_circle_ = nullptr;
-    other.flash_timer_ = nullptr;
+    if (obj_) lv_obj_delete(obj_);
+}
+
+KnobWidget::KnobWidget(KnobWidget&& other) noexcept : obj_(other.obj_) {
+    other.obj_ = nullptr;
 }
 
 KnobWidget& KnobWidget::operator=(KnobWidget&& other) noexcept {
     if (this != &other) {
-        cleanup();
-        container_ = other.container_;
-        arc_ = other.arc_;
-        ribbon_arc_ = other.ribbon_arc_;
-        indicator_ = other.indicator_;
-        center_circle_ = other.center_circle_;
-        inner_circle_ = other.inner_circle_;
-        flash_timer_ = other.flash_timer_;
-        line_points_[0] = other.line_points_[0];
-        line_points_[1] = other.line_points_[1];
-        bg_color_ = other.bg_color_;
-        track_color_ = other.track_color_;
-        value_color_ = other.value_color_;
-        flash_color_ = other.flash_color_;
-        ribbon_color_ = other.ribbon_color_;
-        ribbon_opa_ = other.ribbon_opa_;
-        ribbon_thickness_ratio_ = other.ribbon_thickness_ratio_;
-        value_ = other.value_;
-        origin_ = other.origin_;
-        ribbon_value_ = other.ribbon_value_;
-        centered_ = other.centered_;
-        ribbon_enabled_ = other.ribbon_enabled_;
-        size_policy_ = other.size_policy_;
-        knob_size_ = other.knob_size_;
-        arc_radius_ = other.arc_radius_;
-        indicator_thickness_ = other.indicator_thickness_;
-        center_x_ = other.center_x_;
-        center_y_ = other.center_y_;
-        other.container_ = nullptr;
-        other.arc_ = nullptr;
-        other.ribbon_arc_ = nullptr;
-        other.indicator_ = nullptr;
-        other.center_circle_ = nullptr;
-        other.inner_circle_ = nullptr;
-        other.flash_timer_ = nullptr;
+        if (obj_) lv_obj_delete(obj_);
+        obj_ = other.obj_;
+        other.obj_ = nullptr;
+    }
+    return *this;
+}
+
+// Fluent setters
+KnobWidget& KnobWidget::centered(bool c) {
+    if (!obj_) return *this;
+    KnobData* knob = dataOf(obj_);
+    knob->centered_ = c;
+    if (c && knob->origin_ == 0.0f) {
+        knob->origin_ = 0.5f;
+        knob->value_ = 0.5f;
+    }
+    knob->updateArc();
+    return *this;
+}
+
+KnobWidget& KnobWidget::origin(float o) {
+    if (!obj_) return *this;
+    KnobData* knob = dataOf(obj_);
+    knob->origin_ = std::clamp(o, 0.0f, 1.0f);
+    knob->updateArc();
+    return *this;
+}
+
+KnobWidget& KnobWidget::bgColor(uint32_t color) {
+    if (!obj_) return *this;
+    dataOf(obj_)->bg_color_ = color;
+    dataOf(obj_)->applyColors();
+    return *this;
+}
+
+KnobWidget& KnobWidget::trackColor(uint32_t color) {
+    if (!obj_) return *this;
+    dataOf(obj_)->track_color_ = color;
+    dataOf(obj_)->applyColors();
+    return *this;
+}
+
+KnobWidget& KnobWidget::valueColor(uint32_t color) {
+    if (!obj_) return *this;
+    dataOf(obj_)->value_color_ = color;
+    dataOf(obj_)->applyColors();
+    return *this;
+}
+
+KnobWidget& KnobWidget::flashColor(uint32_t color) {
+    if (obj_) dataOf(obj_)->flash_color_ = color;
+    return *this;
+}
+
+KnobWidget& KnobWidget::ribbonColor(uint32_t color) {
+    if (!obj_) return *this;
+    dataOf(obj_)->ribbon_color_ = color;
+    dataOf(obj_)->applyRibbonColors();
+    return *this;
+}
+
+KnobWidget& KnobWidget::ribbonOpacity(lv_opa_t opa) {
+    if (!obj_) return *this;
+    dataOf(obj_)->ribbon_opa_ = opa;
+    dataOf(obj_)->applyRibbonColors();
+    return *this;
+}
+
+KnobWidget& KnobWidget::ribbonThickness(float ratio) {
+    if (!obj_) return *this;
+    dataOf(obj_)->ribbon_thickness_ratio_ = std::clamp(ratio, 0.1f, 1.0f);
+    dataOf(obj_)->updateGeometry();
+    return *this;
+}
+
+KnobWidget& KnobWidget::ribbonFeed(RibbonMode mode, uint32_t smoothing_ms) {
+    if (!obj_) return *this;
+    KnobData* knob = dataOf(obj_);
+    knob->ribbon_mode_ = mode;
+    knob->ribbon_smoothing_ms_ = smoothing_ms;
+    knob->ribbon_smoothed_valid_ = false;
+    if (!knob->ribbon_feed_) knob->ribbon_feed_ = std::make_unique<RibbonFeed>();
+    if (!knob->ribbon_timer_) {
+        knob->ribbon_timer_ = lv_timer_create(KnobData::ribbonFrameCallback, LV_DEF_REFR_PERIOD, obj_);
+        OC_UI_STAT(Knob, Timers);
     }
+    knob->ribbon_drain_ms_ = lv_tick_get();
     return *this;
 }
 
-void KnobWidget::cleanup() {
-    if (flash_timer_) {
-        lv_timer_delete(flash_timer_);
-        flash_timer_ = nullptr;
+KnobWidget& KnobWidget::sizeMode(SizeMode mode) {
+    if (!obj_) return *this;
+    dataOf(obj_)->size_policy_.mode = mode;
+    dataOf(obj_)->updateGeometry();
+    return *this;
+}
+
+KnobWidget& KnobWidget::staticLayerCache(bool enabled) {
+    if (!obj_) return *this;
+    KnobData* knob = dataOf(obj_);
+    if (knob->static_layer_enabled_ == enabled) return *this;
+    knob->static_layer_enabled_ = enabled;
+    knob->updateGeometry();
+    return *this;
+}
+
+KnobWidget& KnobWidget::lodThresholds(lv_coord_t noInnerBelow, lv_coord_t noIndicatorBelow,
+                                      lv_coord_t squareCapsBelow) {
+    if (!obj_) return *this;
+    KnobData* knob = dataOf(obj_);
+    knob->lod_no_inner_below_ = noInnerBelow;
+    knob->lod_no_indicator_below_ = noIndicatorBelow;
+    knob->lod_square_caps_below_ = squareCapsBelow;
+    knob->updateGeometry();
+    return *this;
+}
+
+void KnobWidget::setValue(float value, bool flash) {
+    if (obj_) dataOf(obj_)->setValue(value, flash);
+}
+
+float KnobWidget::getValue() const {
+    return obj_ ? dataOf(obj_)->value_ : 0.0f;
+}
+
+float KnobWidget::getOrigin() const {
+    return obj_ ? dataOf(obj_)->origin_ : 0.0f;
+}
+
+KnobLod KnobWidget::getLod() const {
+    return obj_ ? dataOf(obj_)->lod_ : KnobLod::Full;
+}
+
+void KnobWidget::applyBankUpdate(const BankUpdate& update, bool flash) {
+    if (!obj_) return;
+    KnobData* knob = dataOf(obj_);
+    OC_UI_STAT(Knob, SetterCalls);  // One call per changed knob, as a setter would count
+    OC_UI_STAT(Knob, SetterChanges);
+
+    if (update.origin_changed) knob->origin_ = update.origin;
+    if (update.value_changed) knob->value_ = update.value;
+    if (update.ribbon_changed) {
+        knob->ribbon_value_ = update.ribbon;
+        knob->ribbon_span_ = false;
+        knob->showRibbon();
+    }
+    if (knob->deferIfHidden()) return;  // No flash either
+
+    // The applied-state check in updateArcAt() remains: 0.25° steps can
+    // still land on the same integer angle and indicator pixel
+    if (update.value_changed || update.origin_changed) {
+        knob->drawn_value_ = knob->value_;
+        knob->updateArcAt(update.value_idx, update.origin_idx);
     }
-    if (container_) {
-        lv_obj_delete(container_);
-        container_ = nullptr;
+    if (update.ribbon_changed) {
+        knob->drawn_ribbon_value_ = knob->ribbon_value_;
+        knob->updateRibbonAt(std::min(update.value_idx, update.ribbon_idx),
+                             std::max(update.value_idx, update.ribbon_idx));
+    } else if (update.value_changed) {
+        knob->updateRibbon();  // Ribbon spans from the value (or its own span)
     }
-    arc_ = nullptr;
-    ribbon_arc_ = nullptr;
-    indicator_ = nullptr;
-    center_circle_ = nullptr;
-    inner_circle_ = nullptr;
+    if (update.value_changed && flash) knob->triggerFlash();
+}
+
+void KnobWidget::setRibbonValue(float value) {
+    if (obj_) dataOf(obj_)->setRibbonValue(value);
+}
+
+void KnobWidget::setRibbonSpan(float from, float to) {
+    if (obj_) dataOf(obj_)->setRibbonSpan(from, to);
+}
+
+void KnobWidget::setRibbonEnabled(bool enabled) {
+    if (obj_) dataOf(obj_)->setRibbonEnabled(enabled);
+}
+
+void KnobWidget::pushRibbonSample(float value) {
+    // No LVGL calls here: only the lock-free feed is touched
+    if (!obj_) return;
+    KnobData* knob = dataOf(obj_);
+    if (knob->ribbon_feed_) knob->ribbon_feed_->push(value);
+}
+
+void KnobWidget::setVisible(bool visible) {
+    if (!obj_) return;
+    if (visible) {
+        lv_obj_clear_flag(obj_, LV_OBJ_FLAG_HIDDEN);
+        deferred::flush();
+    } else {
+        lv_obj_add_flag(obj_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+// ============================================================================
+// KnobData
+// ============================================================================
+
+// Runs from lv_obj_delete() after the children are gone
+KnobData::~KnobData() {
+    if (init_timer_) lv_timer_delete(init_timer_);
+    if (flash_timer_) lv_timer_delete(flash_timer_);
+    if (ribbon_timer_) lv_timer_delete(ribbon_timer_);
+    if (deferred_) deferred::cancel(container_);
+    // Release after the image referencing it is gone
+    KnobLayerCache::release(static_layer_buf_);
 }
 
-void KnobWidget::createUI() {
+void KnobData::createUI() {
     // Size will be controlled by parent (flex/grid)
-    lv_obj_set_style_bg_opa(container_, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(container_, 0, 0);
-    lv_obj_set_style_pad_all(container_, 0, 0);
-    lv_obj_set_style_pad_row(container_, 0, 0);
-    lv_obj_set_style_pad_column(container_, 0, 0);
+    lean::strip(container_);
     lv_obj_add_flag(container_, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
-    lv_obj_set_scrollbar_mode(container_, LV_SCROLLBAR_MODE_OFF);
 
     createArc();
     // ribbon_arc created lazily in setRibbonValue()/setRibbonEnabled()
@@ -124,18 +465,22 @@ void KnobWidget::createUI() {
     createCenterCircles();
     applyColors();
 
-    // Listen for own size changes to recalculate geometry
-    lv_obj_add_event_cb(container_, sizeChangedCallback, LV_EVENT_SIZE_CHANGED, this);
-
     // Defer initial geometry calculation to next frame when layout is ready
-    lv_timer_t* init_timer = lv_timer_create([](lv_timer_t* t) {
-        auto* widget = static_cast<KnobWidget*>(lv_timer_get_user_data(t));
-        if (widget) widget->updateGeometry();
-    }, 0, this);
-    lv_timer_set_repeat_count(init_timer, 1);
+    // (later size changes arrive through eventCallback)
+    init_timer_ = lv_timer_create([](lv_timer_t* t) {
+        KnobData* knob = dataOf(lv_timer_get_user_data(t));
+        knob->init_timer_ = nullptr;  // One-shot: LVGL deletes it after this call
+        knob->updateGeometry();
+    }, 0, container_);
+    lv_timer_set_repeat_count(init_timer_, 1);
+    OC_UI_STAT(Knob, Timers);
+
+#if OC_UI_LVGL_STATIC_ALLOC
+    createFlashTimer();
+#endif
 }
 
-void KnobWidget::createArc() {
+void KnobData::createArc() {
     arc_ = lv_arc_create(container_);
     lv_obj_center(arc_);
     lv_obj_remove_flag(arc_, LV_OBJ_FLAG_CLICKABLE);
@@ -144,7 +489,7 @@ void KnobWidget::createArc() {
     lv_obj_remove_style(arc_, nullptr, LV_PART_KNOB);
 }
 
-void KnobWidget::createRibbon() {
+void KnobData::createRibbon() {
     ribbon_arc_ = lv_arc_create(container_);
     lv_obj_center(ribbon_arc_);
     lv_obj_remove_flag(ribbon_arc_, LV_OBJ_FLAG_CLICKABLE);
@@ -157,7 +502,7 @@ void KnobWidget::createRibbon() {
     lv_obj_add_flag(ribbon_arc_, LV_OBJ_FLAG_HIDDEN);
 }
 
-void KnobWidget::createIndicator() {
+void KnobData::createIndicator() {
     indicator_ = lv_line_create(container_);
     lv_obj_add_flag(indicator_, LV_OBJ_FLAG_EVENT_BUBBLE);
     lv_obj_set_style_line_rounded(indicator_, true, 0);
@@ -168,38 +513,27 @@ void KnobWidget::createIndicator() {
     lv_line_set_points_mutable(indicator_, line_points_, 2);
 }
 
-void KnobWidget::createCenterCircles() {
+void KnobData::createCenterCircles() {
     // Outer circle (value color)
-    center_circle_ = lv_obj_create(container_);
+    center_circle_ = lean::create(container_);
     lv_obj_center(center_circle_);
     lv_obj_set_style_radius(center_circle_, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(center_circle_, 0, 0);
     lv_obj_set_style_bg_opa(center_circle_, LV_OPA_COVER, 0);
-    lv_obj_set_scrollbar_mode(center_circle_, LV_SCROLLBAR_MODE_OFF);
-    lv_obj_remove_flag(center_circle_, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_add_flag(center_circle_, LV_OBJ_FLAG_EVENT_BUBBLE);
 
     // Inner circle (flashes on value change)
-    inner_circle_ = lv_obj_create(container_);
+    inner_circle_ = lean::create(container_);
     lv_obj_center(inner_circle_);
     lv_obj_set_style_radius(inner_circle_, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(inner_circle_, 0, 0);
     lv_obj_set_style_bg_color(inner_circle_, lv_color_hex(base_theme::color::INACTIVE), 0);
     lv_obj_set_style_bg_opa(inner_circle_, LV_OPA_COVER, 0);
-    lv_obj_set_scrollbar_mode(inner_circle_, LV_SCROLLBAR_MODE_OFF);
-    lv_obj_remove_flag(inner_circle_, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_add_flag(inner_circle_, LV_OBJ_FLAG_EVENT_BUBBLE);
 }
 
-void KnobWidget::sizeChangedCallback(lv_event_t* e) {
-    auto* widget = static_cast<KnobWidget*>(lv_event_get_user_data(e));
-    if (widget) {
-        widget->updateGeometry();
-    }
-}
-
-void KnobWidget::updateGeometry() {
+void KnobData::updateGeometry() {
     if (!container_) return;
+    OC_UI_TRACE_SCOPE("KnobWidget::updateGeometry");
+    OC_UI_STAT(Knob, Geometry);
 
     // Compute size using policy
     auto result = size_policy_.compute(container_);
@@ -238,6 +572,8 @@ void KnobWidget::updateGeometry() {
     indicator_thickness_ = knob_size_ * INDICATOR_RATIO;
     lv_coord_t arc_size = make_even(arc_radius_ * 2.0f);
 
+    applyLod(lodFor(knob_size_));
+
     // Update arc
     if (arc_) {
         lv_obj_set_size(arc_, arc_size, arc_size);
@@ -256,10 +592,10 @@ void KnobWidget::updateGeometry() {
     }
 
     // Update indicator line
+    // Fixed size covering the knob: moving the tip never resizes (and fully invalidates) the line
     if (indicator_) {
+        lv_obj_set_size(indicator_, static_cast<lv_coord_t>(knob_size_), static_cast<lv_coord_t>(knob_size_));
         lv_obj_set_style_line_width(indicator_, indicator_thickness, 0);
-        line_points_[0].x = center_x_;
-        line_points_[0].y = center_y_;
     }
 
     // Update center circles
@@ -272,12 +608,28 @@ void KnobWidget::updateGeometry() {
         lv_obj_center(inner_circle_);
     }
 
-    // Update arc value display
+    layer_geometry_.size = static_cast<lv_coord_t>(knob_size_);
+    layer_geometry_.arc_size = arc_size;
+    layer_geometry_.arc_width = arc_width;
+    layer_geometry_.square_caps = lod_ >= KnobLod::SquareCaps;
+    refreshStaticLayer();
+
+    // Geometry changed: force arc/indicator/ribbon to be re-applied
+    resetAppliedGeometry();
     updateArc();
     updateRibbon();
 }
 
-void KnobWidget::applyColors() {
+void KnobData::resetAppliedGeometry() {
+    applied_arc_start_ = -1;
+    applied_arc_end_ = -1;
+    applied_ribbon_start_ = -1;
+    applied_ribbon_end_ = -1;
+    applied_tip_x_ = -1;
+    applied_tip_y_ = -1;
+}
+
+void KnobData::applyColors() {
     uint32_t bg = bg_color_ != 0 ? bg_color_ : base_theme::color::INACTIVE;
     uint32_t track = track_color_ != 0 ? track_color_ : base_theme::color::KNOB_TRACK;
     uint32_t value_col = value_color_ != 0 ? value_color_ : base_theme::color::KNOB_VALUE;
@@ -292,115 +644,220 @@ void KnobWidget::applyColors() {
     if (center_circle_) {
         lv_obj_set_style_bg_color(center_circle_, lv_color_hex(value_col), 0);
     }
-}
 
-void KnobWidget::applyRibbonColors() {
-    if (!ribbon_arc_) return;
-    uint32_t color = ribbon_color_ != 0 ? ribbon_color_ : base_theme::color::MACRO_6_BLUE;
-    lv_obj_set_style_arc_color(ribbon_arc_, lv_color_hex(color), LV_PART_INDICATOR);
-    lv_obj_set_style_arc_opa(ribbon_arc_, ribbon_opa_, LV_PART_INDICATOR);
+    refreshStaticLayer();
 }
 
-// Fluent setters
-KnobWidget& KnobWidget::centered(bool c) {
-    centered_ = c;
-    if (c && origin_ == 0.0f) {
-        origin_ = 0.5f;
-        value_ = 0.5f;
+void KnobData::refreshStaticLayer() {
+    if (!container_ || !static_layer_enabled_ || layer_geometry_.size <= 0) {
+        releaseStaticLayer();
+        return;
     }
-    updateArc();
-    return *this;
+
+    KnobLayerCache::Key key = layer_geometry_;
+    key.bg_color = bg_color_ != 0 ? bg_color_ : base_theme::color::INACTIVE;
+    if (static_layer_buf_ && key == static_layer_key_) return;
+
+    lv_draw_buf_t* buf = KnobLayerCache::acquire(key, container_);
+    if (!buf) {
+        releaseStaticLayer();  // Cache unavailable: keep drawing live
+        return;
+    }
+
+    if (!static_layer_) {
+        // First child: below arcs and indicator
+        static_layer_ = lv_image_create(container_);
+        lv_obj_move_to_index(static_layer_, 0);
+        lv_obj_remove_flag(static_layer_, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_add_flag(static_layer_, LV_OBJ_FLAG_EVENT_BUBBLE);
+    }
+    lv_image_set_src(static_layer_, buf);
+    lv_obj_center(static_layer_);
+
+    bool was_live = static_layer_buf_ == nullptr;
+    KnobLayerCache::release(static_layer_buf_);
+    static_layer_buf_ = buf;
+    static_layer_key_ = key;
+    if (was_live) setLiveStaticParts(false);
 }
 
-KnobWidget& KnobWidget::origin(float o) {
-    origin_ = std::clamp(o, 0.0f, 1.0f);
-    updateArc();
-    return *this;
+void KnobData::releaseStaticLayer() {
+    if (!static_layer_buf_) return;
+    if (static_layer_) {
+        lv_obj_delete(static_layer_);
+        static_layer_ = nullptr;
+    }
+    KnobLayerCache::release(static_layer_buf_);
+    static_layer_buf_ = nullptr;
+    setLiveStaticParts(true);
 }
 
-KnobWidget& KnobWidget::bgColor(uint32_t color) {
-    bg_color_ = color;
-    applyColors();
-    return *this;
+// Cached mode: the background arc comes from the image. The center circles
+// stay live objects above the indicator, so the knob looks the same either way
+void KnobData::setLiveStaticParts(bool live) {
+    if (arc_) {
+        lv_obj_set_style_arc_opa(arc_, live ? LV_OPA_COVER : LV_OPA_TRANSP, LV_PART_MAIN);
+    }
 }
 
-KnobWidget& KnobWidget::trackColor(uint32_t color) {
-    track_color_ = color;
-    applyColors();
-    return *this;
+KnobLod KnobData::lodFor(float size) const {
+    auto below = [size](lv_coord_t threshold) { return size < static_cast<float>(threshold); };
+    if (below(lod_square_caps_below_)) return KnobLod::SquareCaps;
+    if (below(lod_no_indicator_below_)) return KnobLod::NoIndicator;
+    if (below(lod_no_inner_below_)) return KnobLod::NoInnerCircle;
+    return KnobLod::Full;
 }
 
-KnobWidget& KnobWidget::valueColor(uint32_t color) {
-    value_color_ = color;
-    applyColors();
-    return *this;
+// Hidden parts are skipped by the renderer: no rasterization, no invalidation
+void KnobData::applyLod(KnobLod lod) {
+    bool square = lod >= KnobLod::SquareCaps;
+    if (arc_) {
+        lv_obj_set_style_arc_rounded(arc_, !square, LV_PART_MAIN);
+        lv_obj_set_style_arc_rounded(arc_, !square, LV_PART_INDICATOR);
+    }
+    if (ribbon_arc_) lv_obj_set_style_arc_rounded(ribbon_arc_, !square, LV_PART_INDICATOR);
+    if (lod == lod_) return;
+
+    lod_ = lod;
+    if (indicator_) {
+        if (lod_ < KnobLod::NoIndicator) lv_obj_clear_flag(indicator_, LV_OBJ_FLAG_HIDDEN);
+        else lv_obj_add_flag(indicator_, LV_OBJ_FLAG_HIDDEN);
+    }
+    if (center_circle_) {
+        if (lod_ < KnobLod::NoIndicator) lv_obj_clear_flag(center_circle_, LV_OBJ_FLAG_HIDDEN);
+        else lv_obj_add_flag(center_circle_, LV_OBJ_FLAG_HIDDEN);
+    }
+    if (inner_circle_) {
+        if (lod_ < KnobLod::NoInnerCircle) lv_obj_clear_flag(inner_circle_, LV_OBJ_FLAG_HIDDEN);
+        else lv_obj_add_flag(inner_circle_, LV_OBJ_FLAG_HIDDEN);
+    }
 }
 
-KnobWidget& KnobWidget::flashColor(uint32_t color) {
-    flash_color_ = color;
-    return *this;
+void KnobData::applyRibbonColors() {
+    if (!ribbon_arc_) return;
+    uint32_t color = ribbon_color_ != 0 ? ribbon_color_ : base_theme::color::MACRO_6_BLUE;
+    lv_obj_set_style_arc_color(ribbon_arc_, lv_color_hex(color), LV_PART_INDICATOR);
+    lv_obj_set_style_arc_opa(ribbon_arc_, ribbon_opa_, LV_PART_INDICATOR);
 }
 
-KnobWidget& KnobWidget::ribbonColor(uint32_t color) {
-    ribbon_color_ = color;
-    applyRibbonColors();
-    return *this;
+void KnobData::setValue(float value, bool flash) {
+    OC_UI_STAT(Knob, SetterCalls);
+    float clamped = std::clamp(value, 0.0f, 1.0f);
+    value_ = clamped;  // Always kept: relative input builds on getValue()
+    // Less than half a pixel from what is drawn: no redraw, no flash. The
+    // reference is the drawn value, so small steps still add up to one.
+    bool at_end = clamped == 0.0f || clamped == 1.0f;
+    if (std::abs(drawn_value_ - clamped) < valueEpsilon() && (!at_end || drawn_value_ == clamped)) return;
+    OC_UI_STAT(Knob, SetterChanges);
+
+    if (deferIfHidden()) return;  // No flash either
+    updateArc();
+    updateRibbon();  // Ribbon spans from the value
+    if (flash) triggerFlash();
 }
 
-KnobWidget& KnobWidget::ribbonOpacity(lv_opa_t opa) {
-    ribbon_opa_ = opa;
-    applyRibbonColors();
-    return *this;
+// Hidden: only the model was updated, arc and indicator follow once visible
+bool KnobData::deferIfHidden() {
+    if (!deferred::isHidden(container_)) return false;
+    if (deferred_) return true;
+    deferred_ = deferred::defer(container_, [](void* obj) { dataOf(obj)->applyDeferred(); }, container_);
+    if (deferred_) OC_UI_STAT(Knob, Deferred);
+    return deferred_;
 }
 
-KnobWidget& KnobWidget::ribbonThickness(float ratio) {
-    ribbon_thickness_ratio_ = std::clamp(ratio, 0.1f, 1.0f);
-    updateGeometry();
-    return *this;
+void KnobData::applyDeferred() {
+    if (!deferred_) return;
+    deferred_ = false;
+    updateArc();
+    updateRibbon();
 }
 
-KnobWidget& KnobWidget::sizeMode(SizeMode mode) {
-    size_policy_.mode = mode;
-    updateGeometry();
-    return *this;
+float KnobData::valueEpsilon() const {
+    // Value change that moves the indicator tip by half a pixel along the arc
+    if (arc_radius_ <= 0.0f) return FALLBACK_VALUE_EPSILON;
+    return 0.5f / (arc_radius_ * SWEEP_RADIANS);
 }
 
-void KnobWidget::setValue(float value) {
+void KnobData::setRibbonValue(float value) {
+    OC_UI_STAT(Knob, SetterCalls);
     float clamped = std::clamp(value, 0.0f, 1.0f);
-    if (std::abs(value_ - clamped) < 0.001f) return;
+    bool shown = ribbon_arc_ && ribbon_enabled_ && !ribbon_span_;
+    ribbon_value_ = clamped;
+    bool at_end = clamped == 0.0f || clamped == 1.0f;
+    if (shown && std::abs(drawn_ribbon_value_ - clamped) < valueEpsilon() &&
+        (!at_end || drawn_ribbon_value_ == clamped)) {
+        return;  // Model kept, redraw skipped (see setValue)
+    }
+    OC_UI_STAT(Knob, SetterChanges);
 
-    value_ = clamped;
-    updateArc();
-    triggerFlash();
+    ribbon_span_ = false;
+    showRibbon();  // Auto-enable ribbon when value is set
+    if (!deferIfHidden()) updateRibbon();
 }
 
-void KnobWidget::setVisible(bool visible) {
-    if (!container_) return;
-    if (visible) {
-        lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN);
-    } else {
-        lv_obj_add_flag(container_, LV_OBJ_FLAG_HIDDEN);
-    }
+void KnobData::setRibbonSpan(float from, float to) {
+    OC_UI_STAT(Knob, SetterCalls);
+    OC_UI_STAT(Knob, SetterChanges);
+    ribbon_low_ = std::clamp(std::min(from, to), 0.0f, 1.0f);
+    ribbon_high_ = std::clamp(std::max(from, to), 0.0f, 1.0f);
+    ribbon_span_ = true;
+    showRibbon();
+    if (!deferIfHidden()) updateRibbon();
 }
 
-void KnobWidget::setRibbonValue(float value) {
-    float clamped = std::clamp(value, 0.0f, 1.0f);
-    ribbon_value_ = clamped;
+void KnobData::showRibbon() {
     // Lazy-create ribbon arc on first use
     if (!ribbon_arc_) {
         createRibbon();
         applyRibbonColors();
         updateGeometry();  // Apply sizing to newly created arc
     }
-    // Auto-enable ribbon when value is set
     if (!ribbon_enabled_) {
         ribbon_enabled_ = true;
         lv_obj_clear_flag(ribbon_arc_, LV_OBJ_FLAG_HIDDEN);
     }
-    updateRibbon();
 }
 
-void KnobWidget::setRibbonEnabled(bool enabled) {
+void KnobData::ribbonFrameCallback(lv_timer_t* timer) {
+    dataOf(lv_timer_get_user_data(timer))->drainRibbonFeed();
+}
+
+void KnobData::drainRibbonFeed() {
+    // Hidden: leave the samples in the feed, the newest are drained once visible
+    if (!ribbon_feed_ || deferred::isHidden(container_)) return;
+
+    RibbonFeed::Frame frame;
+    bool fresh = ribbon_feed_->drain(frame);
+    uint32_t elapsed = lv_tick_elaps(ribbon_drain_ms_);
+    ribbon_drain_ms_ = lv_tick_get();
+
+    switch (ribbon_mode_) {
+        case RibbonMode::Latest:
+            if (fresh) setRibbonValue(frame.last);
+            break;
+        case RibbonMode::Envelope:
+            // Hold the previous span on frames without samples
+            if (fresh) setRibbonSpan(frame.min, frame.max);
+            break;
+        case RibbonMode::Smooth: {
+            if (fresh) ribbon_target_ = frame.mean;
+            if (!ribbon_smoothed_valid_) {
+                if (!fresh) break;
+                ribbon_smoothed_valid_ = true;
+                setRibbonValue(ribbon_target_);
+                break;
+            }
+            // Keeps converging between samples; alpha = dt / (tau + dt)
+            float dt = static_cast<float>(elapsed);
+            float alpha = dt / (static_cast<float>(ribbon_smoothing_ms_) + dt);
+            if (alpha <= 0.0f) break;
+            setRibbonValue(ribbon_value_ + alpha * (ribbon_target_ - ribbon_value_));
+            break;
+        }
+    }
+}
+
+void KnobData::setRibbonEnabled(bool enabled) {
     ribbon_enabled_ = enabled;
     if (enabled && !ribbon_arc_) {
         // Lazy-create ribbon arc
@@ -417,82 +874,184 @@ void KnobWidget::setRibbonEnabled(bool enabled) {
     }
 }
 
-void KnobWidget::updateRibbon() {
+void KnobData::updateRibbon() {
+    // Ribbon shows between value and ribbon_value, or the explicit span
+    float low = ribbon_span_ ? ribbon_low_ : std::min(value_, ribbon_value_);
+    float high = ribbon_span_ ? ribbon_high_ : std::max(value_, ribbon_value_);
+    drawn_ribbon_value_ = ribbon_value_;
+    updateRibbonAt(knob_angle::index(low), knob_angle::index(high));
+}
+
+void KnobData::updateRibbonAt(uint16_t low_idx, uint16_t high_idx) {
     if (!ribbon_arc_ || !ribbon_enabled_ || arc_radius_ <= 0.0f) return;
 
-    float value_angle = normalizedToAngle(value_);
-    float ribbon_angle = normalizedToAngle(ribbon_value_);
+    int16_t start = knob_angle::degrees(low_idx);
+    int16_t end = knob_angle::degrees(high_idx);
+    if (start == applied_ribbon_start_ && end == applied_ribbon_end_) return;
 
-    // Ribbon shows between value and ribbon_value
-    if (ribbon_value_ >= value_) {
-        lv_arc_set_angles(ribbon_arc_, static_cast<int16_t>(value_angle),
-                         static_cast<int16_t>(ribbon_angle));
+    if (applied_ribbon_start_ < 0) {
+        lv_arc_set_angles(ribbon_arc_, start, end);
     } else {
-        lv_arc_set_angles(ribbon_arc_, static_cast<int16_t>(ribbon_angle),
-                         static_cast<int16_t>(value_angle));
+        {
+            ScopedInvalidationOff no_invalidate(container_);
+            lv_arc_set_angles(ribbon_arc_, start, end);
+        }
+        if (start != applied_ribbon_start_) invalidateSweep(applied_ribbon_start_, start);
+        if (end != applied_ribbon_end_) invalidateSweep(applied_ribbon_end_, end);
     }
+    applied_ribbon_start_ = start;
+    applied_ribbon_end_ = end;
 }
 
-void KnobWidget::updateArc() {
+void KnobData::updateArc() {
+    drawn_value_ = value_;
+    updateArcAt(knob_angle::index(value_), knob_angle::index(origin_));
+}
+
+void KnobData::updateArcAt(uint16_t value_idx, uint16_t origin_idx) {
     if (!arc_ || !indicator_ || arc_radius_ <= 0.0f) return;
+    OC_UI_TRACE_SCOPE("KnobWidget::updateArc");
+
+    int16_t origin_deg = knob_angle::degrees(origin_idx);
+    int16_t value_deg = knob_angle::degrees(value_idx);
 
-    float origin_angle = normalizedToAngle(origin_);
-    float value_angle = normalizedToAngle(value_);
+    int16_t start = value_idx >= origin_idx ? origin_deg : value_deg;
+    int16_t end = value_idx >= origin_idx ? value_deg : origin_deg;
 
-    if (value_ >= origin_) {
-        lv_arc_set_angles(arc_, static_cast<int16_t>(origin_angle),
-                         static_cast<int16_t>(value_angle));
+    // Float endpoint for sub-pixel precision, integer tip for change detection
+    float cos_v = knob_angle::cosAt(value_idx);
+    float sin_v = knob_angle::sinAt(value_idx);
+    float end_x = center_x_ + arc_radius_ * cos_v;
+    float end_y = center_y_ + arc_radius_ * sin_v;
+
+    auto tip_x = static_cast<lv_coord_t>(end_x + 0.5f);
+    auto tip_y = static_cast<lv_coord_t>(end_y + 0.5f);
+
+    bool arc_changed = start != applied_arc_start_ || end != applied_arc_end_;
+    bool tip_changed = lod_ < KnobLod::NoIndicator && (tip_x != applied_tip_x_ || tip_y != applied_tip_y_);
+    if (!arc_changed && !tip_changed) return;
+
+    if (applied_arc_start_ < 0) {
+        // First apply after a geometry change: whole objects are redrawn anyway
+        lv_arc_set_angles(arc_, start, end);
+        line_points_[0].x = center_x_;
+        line_points_[0].y = center_y_;
+        line_points_[1].x = end_x;
+        line_points_[1].y = end_y;
+        lv_obj_invalidate(indicator_);
     } else {
-        lv_arc_set_angles(arc_, static_cast<int16_t>(value_angle),
-                         static_cast<int16_t>(origin_angle));
+        // Only the swept band and the old/new indicator need redrawing
+        lv_point_precise_t old_pivot = line_points_[0];
+        lv_point_precise_t old_tip = line_points_[1];
+        if (arc_changed) {
+            ScopedInvalidationOff no_invalidate(container_);
+            lv_arc_set_angles(arc_, start, end);
+        }
+        line_points_[0].x = center_x_;
+        line_points_[0].y = center_y_;
+        line_points_[1].x = end_x;
+        line_points_[1].y = end_y;
+
+        if (start != applied_arc_start_) invalidateSweep(applied_arc_start_, start);
+        if (end != applied_arc_end_) invalidateSweep(applied_arc_end_, end);
+        if (tip_changed) {
+            invalidateIndicator(old_pivot, old_tip);
+            invalidateIndicator(line_points_[0], line_points_[1]);
+        }
     }
 
-    float angle_rad = value_angle * static_cast<float>(M_PI) / 180.0f;
-    updateIndicatorLine(angle_rad);
+    applied_arc_start_ = start;
+    applied_arc_end_ = end;
+    applied_tip_x_ = tip_x;
+    applied_tip_y_ = tip_y;
 }
 
-void KnobWidget::updateIndicatorLine(float angleRad) {
-    // All calculations in float for precision
-    float end_x = center_x_ + arc_radius_ * std::cos(angleRad);
-    float end_y = center_y_ + arc_radius_ * std::sin(angleRad);
+void KnobData::invalidateSweep(int16_t fromDeg, int16_t toDeg) {
+    if (fromDeg > toDeg) std::swap(fromDeg, toDeg);
+
+    lv_area_t arc_coords;
+    lv_obj_get_coords(arc_, &arc_coords);
+    float cx = (arc_coords.x1 + arc_coords.x2 + 1) * 0.5f;
+    float cy = (arc_coords.y1 + arc_coords.y2 + 1) * 0.5f;
+
+    // Band covers the whole ring width (background, value and ribbon arcs)
+    float arc_width = knob_size_ * ARC_WIDTH_RATIO;
+    float mid_radius = (arc_coords.x2 - arc_coords.x1 + 1) * 0.5f - arc_width * 0.5f;
+
+    float min_x = cx, max_x = cx, min_y = cy, max_y = cy;
+    bool first = true;
+    auto include = [&](uint16_t idx) {
+        float x = cx + mid_radius * knob_angle::cosAt(idx);
+        float y = cy + mid_radius * knob_angle::sinAt(idx);
+        min_x = first ? x : std::min(min_x, x);
+        max_x = first ? x : std::max(max_x, x);
+        min_y = first ? y : std::min(min_y, y);
+        max_y = first ? y : std::max(max_y, y);
+        first = false;
+    };
+    include(degreesToIndex(fromDeg));
+    include(degreesToIndex(toDeg));
+
+    // Ring extremes (left, top, right) crossed by the sweep
+    for (int16_t cardinal : {int16_t(180), int16_t(270), int16_t(360)}) {
+        if (cardinal > fromDeg && cardinal < toDeg) include(degreesToIndex(cardinal));
+    }
 
-    // Update line endpoint (lv_point_precise_t uses float)
-    line_points_[1].x = end_x;
-    line_points_[1].y = end_y;
-    lv_obj_refresh_self_size(indicator_);
+    // Half ring width plus anti-aliasing/rounding slack
+    auto margin = static_cast<lv_coord_t>(arc_width * 0.5f) + 2;
+    lv_area_t area;
+    area.x1 = static_cast<lv_coord_t>(min_x) - margin;
+    area.y1 = static_cast<lv_coord_t>(min_y) - margin;
+    area.x2 = static_cast<lv_coord_t>(max_x) + margin;
+    area.y2 = static_cast<lv_coord_t>(max_y) + margin;
+    lv_obj_invalidate_area(container_, &area);
 }
 
-float KnobWidget::normalizedToAngle(float normalized) const {
-    return START_ANGLE + (normalized * ARC_SWEEP_DEGREES);
+void KnobData::invalidateIndicator(const lv_point_precise_t& pivot, const lv_point_precise_t& tip) {
+    lv_area_t coords;
+    lv_obj_get_coords(indicator_, &coords);
+
+    // Half line width for the rounded caps plus anti-aliasing slack
+    auto margin = static_cast<lv_coord_t>(indicator_thickness_ * 0.5f) + 2;
+    lv_area_t area;
+    area.x1 = coords.x1 + static_cast<lv_coord_t>(std::min(pivot.x, tip.x)) - margin;
+    area.y1 = coords.y1 + static_cast<lv_coord_t>(std::min(pivot.y, tip.y)) - margin;
+    area.x2 = coords.x1 + static_cast<lv_coord_t>(std::max(pivot.x, tip.x)) + margin;
+    area.y2 = coords.y1 + static_cast<lv_coord_t>(std::max(pivot.y, tip.y)) + margin;
+    lv_obj_invalidate_area(container_, &area);
 }
 
-void KnobWidget::triggerFlash() {
-    if (!inner_circle_) return;
+void KnobData::triggerFlash() {
+    if (!inner_circle_ || lod_ >= KnobLod::NoInnerCircle) return;
 
-    // Rate-limit flash to avoid excessive timer creation during rapid encoder movement
+    // Rate-limit flash to avoid restyling on every step of rapid encoder movement
     uint32_t now = lv_tick_get();
     if (now - last_flash_ms_ < FLASH_RATE_LIMIT_MS) return;
     last_flash_ms_ = now;
-
-    if (flash_timer_) {
-        lv_timer_delete(flash_timer_);
-        flash_timer_ = nullptr;
-    }
+    OC_UI_STAT(Knob, Flashes);
 
     uint32_t flash = flash_color_ != 0 ? flash_color_ : base_theme::color::ACTIVE;
     lv_obj_set_style_bg_color(inner_circle_, lv_color_hex(flash), 0);
 
-    flash_timer_ = lv_timer_create(flashTimerCallback, base_theme::animation::FLASH_DURATION_MS, this);
-    lv_timer_set_repeat_count(flash_timer_, 1);
+    // Restart the existing timer: a new flash extends the current one
+    if (!flash_timer_) createFlashTimer();
+    lv_timer_reset(flash_timer_);
+    lv_timer_resume(flash_timer_);
+}
+
+void KnobData::createFlashTimer() {
+    flash_timer_ = lv_timer_create(flashTimerCallback, base_theme::animation::FLASH_DURATION_MS, container_);
+    lv_timer_pause(flash_timer_);
+    OC_UI_STAT(Knob, Timers);
 }
 
-void KnobWidget::flashTimerCallback(lv_timer_t* timer) {
-    auto* widget = static_cast<KnobWidget*>(lv_timer_get_user_data(timer));
-    if (!widget || !widget->inner_circle_) return;
+void KnobData::flashTimerCallback(lv_timer_t* timer) {
+    lv_timer_pause(timer);  // Kept for the next flash
+    KnobData* knob = dataOf(lv_timer_get_user_data(timer));
+    if (!knob->inner_circle_) return;
 
-    uint32_t bg = widget->bg_color_ != 0 ? widget->bg_color_ : base_theme::color::INACTIVE;
-    lv_obj_set_style_bg_color(widget->inner_circle_, lv_color_hex(bg), 0);
-    widget->flash_timer_ = nullptr;
+    uint32_t bg = knob->bg_color_ != 0 ? knob->bg_color_ : base_theme::color::INACTIVE;
+    lv_obj_set_style_bg_color(knob->inner_circle_, lv_color_hex(bg), 0);
 }
 
 }  // namespace oc::ui::lvgl
@@ -1,13 +1,24 @@
 #include <oc/ui/lvgl/widget/Label.hpp>
 
+#include <cstring>
+
+#include <oc/ui/lvgl/Deferred.hpp>
+#include <oc/ui/lvgl/LeanObject.hpp>
+#include <oc/ui/lvgl/Stats.hpp>
+#include <oc/ui/lvgl/Trace.hpp>
+
 namespace oc::ui::lvgl {
 
 // =============================================================================
 // Construction / Destruction
 // =============================================================================
 
-Label::Label(lv_obj_t* parent) {
-    createWidgets(parent);
+Label::Label(lv_obj_t* parent, ObjectTree tree) : lean_(tree == ObjectTree::Lean) {
+    if (lean_) {
+        createLeanWidgets(parent);
+    } else {
+        createWidgets(parent);
+    }
 }
 
 Label::~Label() {
@@ -19,21 +30,26 @@ Label::Label(Label&& other) noexcept
     : container_(other.container_),
       label_(other.label_),
       pending_timer_(other.pending_timer_),
+      pause_timer_(other.pause_timer_),
       auto_scroll_enabled_(other.auto_scroll_enabled_),
       anim_running_(other.anim_running_),
       owns_lvgl_objects_(other.owns_lvgl_objects_),
+      lean_(other.lean_),
+      deferred_(other.deferred_),
       overflow_amount_(other.overflow_amount_),
       alignment_(other.alignment_),
       scroll_duration_ms_(other.scroll_duration_ms_),
       pause_duration_ms_(other.pause_duration_ms_) {
-    // Update timer's user_data to point to new object
-    if (pending_timer_) {
-        lv_timer_set_user_data(pending_timer_, this);
-    }
+#if OC_UI_LVGL_STATIC_ALLOC
+    std::memcpy(text_, other.text_, sizeof(text_));
+#endif
+    relinkCallbacks(&other);
     other.container_ = nullptr;
     other.label_ = nullptr;
     other.pending_timer_ = nullptr;
+    other.pause_timer_ = nullptr;
     other.anim_running_ = false;
+    other.deferred_ = false;
 }
 
 Label& Label::operator=(Label&& other) noexcept {
@@ -44,37 +60,57 @@ Label& Label::operator=(Label&& other) noexcept {
         container_ = other.container_;
         label_ = other.label_;
         pending_timer_ = other.pending_timer_;
+        pause_timer_ = other.pause_timer_;
         auto_scroll_enabled_ = other.auto_scroll_enabled_;
         anim_running_ = other.anim_running_;
         owns_lvgl_objects_ = other.owns_lvgl_objects_;
+        lean_ = other.lean_;
+        deferred_ = other.deferred_;
         overflow_amount_ = other.overflow_amount_;
         alignment_ = other.alignment_;
         scroll_duration_ms_ = other.scroll_duration_ms_;
         pause_duration_ms_ = other.pause_duration_ms_;
-
-        // Update timer's user_data to point to new object
-        if (pending_timer_) {
-            lv_timer_set_user_data(pending_timer_, this);
-        }
+#if OC_UI_LVGL_STATIC_ALLOC
+        std::memcpy(text_, other.text_, sizeof(text_));
+#endif
+        relinkCallbacks(&other);
 
         other.container_ = nullptr;
         other.label_ = nullptr;
         other.pending_timer_ = nullptr;
+        other.pause_timer_ = nullptr;
         other.anim_running_ = false;
+        other.deferred_ = false;
     }
     return *this;
 }
 
+// LVGL holds `this` in the size event, timers and running scroll animation
+// (and the static text buffer), deferred:: in a pending measure: re-point
+// them at the moved-to object
+void Label::relinkCallbacks(void* previous) {
+    if (container_ && !lean_) {
+        lv_obj_remove_event_cb_with_user_data(container_, sizeChangedCallback, previous);
+        lv_obj_add_event_cb(container_, sizeChangedCallback, LV_EVENT_SIZE_CHANGED, this);
+    }
+    if (pending_timer_) lv_timer_set_user_data(pending_timer_, this);
+    if (pause_timer_) lv_timer_set_user_data(pause_timer_, this);
+    if (deferred_) deferred::retarget(previous, this);
+    if (anim_running_) {
+        lv_anim_t* anim = lv_anim_get(previous, scrollAnimCallback);
+        if (anim) anim->var = this;
+    }
+#if OC_UI_LVGL_STATIC_ALLOC
+    if (label_) lv_label_set_text_static(label_, text_);
+#endif
+}
+
 void Label::createWidgets(lv_obj_t* parent) {
     // Container that clips overflow
-    container_ = lv_obj_create(parent);
+    container_ = lean::create(parent);
     // Default size: 100% width, content height
     // Works with flex layouts and grid rows using LV_GRID_CONTENT
     lv_obj_set_size(container_, LV_PCT(100), LV_SIZE_CONTENT);
-    lv_obj_set_style_bg_opa(container_, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(container_, 0, 0);
-    lv_obj_set_style_pad_all(container_, 0, 0);
-    lv_obj_clear_flag(container_, LV_OBJ_FLAG_SCROLLABLE);
     // Clip overflow for scroll animation
     lv_obj_clear_flag(container_, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
     // Bubble events to parent for click handling
@@ -84,19 +120,66 @@ void Label::createWidgets(lv_obj_t* parent) {
 
     // The actual label - full width, content height
     label_ = lv_label_create(container_);
+#if OC_UI_LVGL_STATIC_ALLOC
+    lv_label_set_text_static(label_, text_);
+    createMeasureTimer();
+    createPauseTimer();
+#else
     lv_label_set_text(label_, "");
+#endif
     lv_obj_set_width(label_, LV_SIZE_CONTENT);
     lv_obj_set_style_pad_all(label_, 0, 0);
     lv_label_set_long_mode(label_, LV_LABEL_LONG_CLIP);
     lv_obj_add_flag(label_, LV_OBJ_FLAG_EVENT_BUBBLE);
 }
 
+// Lean tree: the lv_label is the element. LVGL scrolls overflowing text
+// itself and lv_label isn't clickable, so clicks land on the parent
+// without bubbling.
+void Label::createLeanWidgets(lv_obj_t* parent) {
+    label_ = lv_label_create(parent);
+    container_ = label_;
+    lv_obj_set_size(label_, LV_PCT(100), LV_SIZE_CONTENT);
+    lv_obj_set_style_pad_all(label_, 0, 0);
+#if OC_UI_LVGL_STATIC_ALLOC
+    lv_label_set_text_static(label_, text_);
+#else
+    lv_label_set_text(label_, "");
+#endif
+    applyLeanMode();
+}
+
+void Label::applyLeanMode() {
+    lv_obj_set_style_text_align(label_, alignment_, 0);
+    lv_label_set_long_mode(label_, auto_scroll_enabled_ ? LV_LABEL_LONG_SCROLL : LV_LABEL_LONG_CLIP);
+}
+
+void Label::createMeasureTimer() {
+    pending_timer_ = lv_timer_create(measureTimerCallback, 0, this);
+    lv_timer_pause(pending_timer_);
+    OC_UI_STAT(Label, Timers);
+}
+
+void Label::createPauseTimer() {
+    pause_timer_ = lv_timer_create(pauseTimerCallback, pause_duration_ms_, this);
+    lv_timer_pause(pause_timer_);
+    OC_UI_STAT(Label, Timers);
+}
+
 void Label::cleanup() {
-    // Cancel any pending timer to prevent use-after-free
+    if (deferred_) {
+        deferred::cancel(this);
+        deferred_ = false;
+    }
+    // Delete timers to prevent use-after-free
     if (pending_timer_) {
         lv_timer_delete(pending_timer_);
         pending_timer_ = nullptr;
     }
+    if (pause_timer_) {
+        lv_timer_delete(pause_timer_);
+        pause_timer_ = nullptr;
+    }
     if (container_ && owns_lvgl_objects_) {
         lv_obj_delete(container_);
     }
@@ -110,11 +193,13 @@ void Label::cleanup() {
 
 Label& Label::autoScroll(bool enabled) {
     auto_scroll_enabled_ = enabled;
+    if (lean_ && label_) applyLeanMode();
     return *this;
 }
 
 Label& Label::alignment(lv_text_align_t align) {
     alignment_ = align;
+    if (lean_ && label_) applyLeanMode();
     return *this;
 }
 
@@ -172,15 +257,25 @@ Label& Label::gridCell(uint8_t col, uint8_t colSpan, uint8_t row, uint8_t rowSpa
 // Data Setters
 // =============================================================================
 
+#if !OC_UI_LVGL_STATIC_ALLOC
 void Label::setText(const std::string& text) {
     setText(text.c_str());
 }
+#endif
 
 void Label::setText(int value, const char* prefix, const char* suffix) {
     if (!label_) return;
+    OC_UI_STAT(Label, SetterCalls);  // Formatted setters only count calls
     stopScrollAnimation();
+#if OC_UI_LVGL_STATIC_ALLOC
+    lv_snprintf(text_, sizeof(text_), "%s%d%s", prefix, value, suffix);
+    lv_label_set_text_static(label_, text_);
+#else
     lv_label_set_text_fmt(label_, "%s%d%s", prefix, value, suffix);
+#endif
+    if (lean_) return;  // LVGL lays out and scrolls lean labels
     if (auto_scroll_enabled_) {
+        if (deferIfHidden()) return;
         checkOverflowAndScroll();
     } else {
         applyStaticAlignment();
@@ -189,11 +284,19 @@ void Label::setText(int value, const char* prefix, const char* suffix) {
 
 void Label::setText(float value, uint8_t decimals, const char* prefix, const char* suffix) {
     if (!label_) return;
+    OC_UI_STAT(Label, SetterCalls);
     stopScrollAnimation();
     char fmt[16];
     lv_snprintf(fmt, sizeof(fmt), "%%s%%.%uf%%s", decimals);
+#if OC_UI_LVGL_STATIC_ALLOC
+    lv_snprintf(text_, sizeof(text_), fmt, prefix, value, suffix);
+    lv_label_set_text_static(label_, text_);
+#else
     lv_label_set_text_fmt(label_, fmt, prefix, value, suffix);
+#endif
+    if (lean_) return;
     if (auto_scroll_enabled_) {
+        if (deferIfHidden()) return;
         checkOverflowAndScroll();
     } else {
         applyStaticAlignment();
@@ -202,25 +305,52 @@ void Label::setText(float value, uint8_t decimals, const char* prefix, const cha
 
 void Label::setText(const char* text) {
     if (!label_) return;
+    OC_UI_STAT(Label, SetterCalls);
+#if OC_UI_LVGL_STATS
+    const char* current = lv_label_get_text(label_);
+    if (!current || !text || std::strcmp(current, text) != 0) OC_UI_STAT(Label, SetterChanges);
+#endif
 
     stopScrollAnimation();
-    lv_label_set_text(label_, text);
-
-    // Cancel any previous pending timer
-    if (pending_timer_) {
-        lv_timer_delete(pending_timer_);
-        pending_timer_ = nullptr;
+#if OC_UI_LVGL_STATIC_ALLOC
+    if (text != text_) {
+        std::strncpy(text_, text ? text : "", sizeof(text_) - 1);
     }
+    lv_label_set_text_static(label_, text_);
+#else
+    lv_label_set_text(label_, text);
+#endif
 
     // Defer overflow check to next frame when layout is ready
-    pending_timer_ = lv_timer_create([](lv_timer_t* t) {
-        auto* self = static_cast<Label*>(lv_timer_get_user_data(t));
-        if (self) {
-            self->pending_timer_ = nullptr;  // Clear before callback
-            self->checkOverflowAndScroll();
-        }
-    }, 0, this);
-    lv_timer_set_repeat_count(pending_timer_, 1);
+    if (!lean_ && !deferIfHidden()) scheduleMeasure(0);
+}
+
+// Hidden: the text is stored (cheap, nothing is redrawn), the layout pass
+// and scroll animation wait until the label is visible
+bool Label::deferIfHidden() {
+    if (!deferred::isHidden(container_)) return false;
+    if (deferred_) return true;
+    deferred_ = deferred::defer(container_, [](void* target) {
+        auto* self = static_cast<Label*>(target);
+        self->deferred_ = false;
+        self->scheduleMeasure(0);
+    }, this);
+    if (deferred_) OC_UI_STAT(Label, Deferred);
+    return deferred_;
+}
+
+void Label::scheduleMeasure(uint32_t delay_ms) {
+    // One timer per label, restarted (and so coalesced) by every request
+    if (!pending_timer_) createMeasureTimer();
+    lv_timer_set_period(pending_timer_, delay_ms);
+    lv_timer_reset(pending_timer_);
+    lv_timer_resume(pending_timer_);
+}
+
+void Label::measureTimerCallback(lv_timer_t* timer) {
+    lv_timer_pause(timer);  // Before the check: it may reschedule
+    auto* self = static_cast<Label*>(lv_timer_get_user_data(timer));
+    if (self) self->checkOverflowAndScroll();
 }
 
 // =============================================================================
@@ -229,6 +359,7 @@ void Label::setText(const char* text) {
 
 void Label::checkOverflowAndScroll() {
     if (!label_ || !container_) return;
+    OC_UI_TRACE_SCOPE("Label::checkOverflowAndScroll");
 
     // Update full layout hierarchy to ensure dimensions are computed
     lv_obj_t* parent = lv_obj_get_parent(container_);
@@ -246,20 +377,12 @@ void Label::checkOverflowAndScroll() {
 
     // Still no width? Schedule retry - layout not ready yet
     if (container_width <= 0) {
-        if (!pending_timer_) {
-            pending_timer_ = lv_timer_create([](lv_timer_t* t) {
-                auto* self = static_cast<Label*>(lv_timer_get_user_data(t));
-                if (self) {
-                    self->pending_timer_ = nullptr;
-                    self->checkOverflowAndScroll();
-                }
-            }, 10, this);  // Retry after 10ms
-            lv_timer_set_repeat_count(pending_timer_, 1);
-        }
+        scheduleMeasure(10);  // Retry after 10ms
         return;
     }
 
     // Measure text width
+    OC_UI_STAT(Label, Measures);
     lv_label_set_long_mode(label_, LV_LABEL_LONG_WRAP);
     lv_obj_set_width(label_, LV_SIZE_CONTENT);
     lv_obj_update_layout(label_);
@@ -305,15 +428,20 @@ void Label::startScrollAnimation() {
     lv_anim_set_path_cb(&scroll_anim_, lv_anim_path_ease_in_out);
     lv_anim_set_completed_cb(&scroll_anim_, [](lv_anim_t* a) {
         auto* self = static_cast<Label*>(a->var);
-        lv_timer_t* timer = lv_timer_create(pauseTimerCallback, self->pause_duration_ms_, self);
-        lv_timer_set_repeat_count(timer, 1);
+        // Paused again by stop/destroy (it would restart the scroll)
+        if (!self->pause_timer_) self->createPauseTimer();
+        lv_timer_set_period(self->pause_timer_, self->pause_duration_ms_);
+        lv_timer_reset(self->pause_timer_);
+        lv_timer_resume(self->pause_timer_);
     });
 
     lv_anim_start(&scroll_anim_);
+    OC_UI_STAT(Label, Anims);
     anim_running_ = true;
 }
 
 void Label::stopScrollAnimation() {
+    if (pause_timer_) lv_timer_pause(pause_timer_);
     if (anim_running_) {
         lv_anim_delete(this, nullptr);
         anim_running_ = false;
@@ -346,6 +474,7 @@ void Label::scrollAnimCallback(void* var, int32_t value) {
 }
 
 void Label::pauseTimerCallback(lv_timer_t* timer) {
+    lv_timer_pause(timer);  // Kept for the next scroll cycle
     auto* self = static_cast<Label*>(lv_timer_get_user_data(timer));
     if (!self || !self->label_) return;
 
@@ -362,6 +491,7 @@ void Label::pauseTimerCallback(lv_timer_t* timer) {
     });
 
     lv_anim_start(&anim);
+    OC_UI_STAT(Label, Anims);
 }
 
 void Label::sizeChangedCallback(lv_event_t* e) {
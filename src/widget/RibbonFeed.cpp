@@ -0,0 +1,54 @@
+#include <oc/ui/lvgl/widget/RibbonFeed.hpp>
+
+#include <algorithm>
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+constexpr float QUANT_SCALE = 65535.0f;
+
+// Tag = position + 1, so zero-initialized slots never look written
+constexpr uint32_t tagFor(uint32_t pos) { return (pos + 1) & 0xFFFFu; }
+
+}  // namespace
+
+void RibbonFeed::push(float value) {
+    float clamped = std::clamp(value, 0.0f, 1.0f);
+    auto q = static_cast<uint32_t>(clamped * QUANT_SCALE + 0.5f);
+
+    uint32_t pos = write_.fetch_add(1, std::memory_order_relaxed);
+    slots_[pos & (CAPACITY - 1)].store((tagFor(pos) << 16) | q, std::memory_order_release);
+}
+
+bool RibbonFeed::drain(Frame& out) {
+    uint32_t end = write_.load(std::memory_order_acquire);
+    uint32_t pending = end - read_;
+    if (pending == 0) return false;
+
+    // Only the last CAPACITY positions can still be in the ring
+    uint32_t begin = pending > CAPACITY ? end - CAPACITY : read_;
+    read_ = end;
+
+    Frame frame;
+    float sum = 0.0f;
+    for (uint32_t pos = begin; pos != end; ++pos) {
+        uint32_t slot = slots_[pos & (CAPACITY - 1)].load(std::memory_order_acquire);
+        if ((slot >> 16) != tagFor(pos)) continue;  // Overwritten or not yet stored
+
+        float value = static_cast<float>(slot & 0xFFFFu) / QUANT_SCALE;
+        frame.min = frame.count == 0 ? value : std::min(frame.min, value);
+        frame.max = frame.count == 0 ? value : std::max(frame.max, value);
+        frame.last = value;
+        sum += value;
+        frame.count++;
+    }
+    frame.dropped = pending - frame.count;
+    if (frame.count == 0) return false;
+
+    frame.mean = sum / static_cast<float>(frame.count);
+    out = frame;
+    return true;
+}
+
+}  // namespace oc::ui::lvgl
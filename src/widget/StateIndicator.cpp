@@ -1,58 +1,57 @@
 #include <oc/ui/lvgl/widget/StateIndicator.hpp>
 
+#include <new>
 #include <utility>
 
+#include <lvgl_private.h>  // lv_obj_class_t layout
+
+#include <oc/ui/lvgl/Deferred.hpp>
+#include <oc/ui/lvgl/LeanObject.hpp>
+#include <oc/ui/lvgl/Stats.hpp>
+
 namespace oc::ui::lvgl {
 
-StateIndicator::StateIndicator(lv_obj_t* parent, lv_coord_t size) {
-    led_ = lv_obj_create(parent);
-    lv_obj_set_size(led_, size, size);
-    lv_obj_set_style_radius(led_, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(led_, 0, 0);
-    lv_obj_set_style_bg_opa(led_, LV_OPA_COVER, 0);
-    lv_obj_set_scrollbar_mode(led_, LV_SCROLLBAR_MODE_OFF);
+namespace {
 
-    applyState();
-}
+/** Indicator state, stored in the LED object's own allocation */
+struct IndicatorData {
+    void applyState(lv_obj_t* led);
 
-StateIndicator::~StateIndicator() {
-    if (led_) {
-        lv_obj_delete(led_);
-        led_ = nullptr;
-    }
-}
+    StateIndicator::State current_state_ = StateIndicator::State::OFF;
+    bool deferred_ = false;  // State changed while hidden, queued in deferred::
 
-StateIndicator::StateIndicator(StateIndicator&& other) noexcept
-    : led_(other.led_),
-      current_state_(other.current_state_) {
-    for (int i = 0; i < 3; ++i) {
-        colors_[i] = other.colors_[i];
-        opacities_[i] = other.opacities_[i];
-    }
-    other.led_ = nullptr;
-}
+    // Colors indexed by State enum (0=OFF, 1=ACTIVE, 2=PRESSED)
+    uint32_t colors_[3] = {0, 0, 0};
+    // Opacities indexed by State enum, 0 = use default
+    lv_opa_t opacities_[3] = {0, 0, 0};
+};
 
-StateIndicator& StateIndicator::operator=(StateIndicator&& other) noexcept {
-    if (this != &other) {
-        if (led_) {
-            lv_obj_delete(led_);
-        }
+/** Indicator instance: LVGL's base object followed by the indicator state */
+struct IndicatorObject {
+    lv_obj_t obj;
+    IndicatorData data;
+};
 
-        led_ = other.led_;
-        current_state_ = other.current_state_;
-        for (int i = 0; i < 3; ++i) {
-            colors_[i] = other.colors_[i];
-            opacities_[i] = other.opacities_[i];
-        }
+IndicatorData* dataOf(void* obj) {
+    return &static_cast<IndicatorObject*>(obj)->data;
+}
 
-        other.led_ = nullptr;
-    }
-    return *this;
+void constructorCallback(const lv_obj_class_t*, lv_obj_t* obj) {
+    new (dataOf(obj)) IndicatorData();
 }
 
-void StateIndicator::applyState() {
-    if (!led_) return;
+void destructorCallback(const lv_obj_class_t*, lv_obj_t* obj) {
+    if (dataOf(obj)->deferred_) deferred::cancel(obj);
+    dataOf(obj)->~IndicatorData();
+}
 
+void applyDeferred(void* obj) {
+    IndicatorData* data = dataOf(obj);
+    data->deferred_ = false;
+    data->applyState(static_cast<lv_obj_t*>(obj));
+}
+
+void IndicatorData::applyState(lv_obj_t* led) {
     int idx = static_cast<int>(current_state_);
 
     // Default colors per state
@@ -72,15 +71,63 @@ void StateIndicator::applyState() {
     uint32_t col = colors_[idx] != 0 ? colors_[idx] : DEFAULT_COLORS[idx];
     lv_opa_t opa = opacities_[idx] != 0 ? opacities_[idx] : DEFAULT_OPACITIES[idx];
 
-    lv_obj_set_style_bg_color(led_, lv_color_hex(col), 0);
-    lv_obj_set_style_bg_opa(led_, opa, 0);
+    lv_obj_set_style_bg_color(led, lv_color_hex(col), 0);
+    lv_obj_set_style_bg_opa(led, opa, 0);
+}
+
+}  // namespace
+
+const lv_obj_class_t* StateIndicator::objClass() {
+    static const lv_obj_class_t cls = [] {
+        lv_obj_class_t c{};
+        c.base_class = &lv_obj_class;
+        c.constructor_cb = constructorCallback;
+        c.destructor_cb = destructorCallback;
+        c.name = "oc_state_indicator";
+        c.width_def = LV_DPI_DEF;
+        c.height_def = LV_DPI_DEF;
+        c.instance_size = sizeof(IndicatorObject);
+        c.theme_inheritable = LV_OBJ_CLASS_THEME_INHERITABLE_TRUE;
+        return c;
+    }();
+    return &cls;
+}
+
+StateIndicator::StateIndicator(lv_obj_t* parent, lv_coord_t size) {
+    led_ = lv_obj_class_create_obj(objClass(), parent);
+    lv_obj_class_init_obj(led_);
+    lean::strip(led_);
+    lv_obj_set_size(led_, size, size);
+    lv_obj_set_style_radius(led_, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_bg_opa(led_, LV_OPA_COVER, 0);
+
+    dataOf(led_)->applyState(led_);
+}
+
+StateIndicator::~StateIndicator() {
+    if (led_) lv_obj_delete(led_);
+}
+
+StateIndicator::StateIndicator(StateIndicator&& other) noexcept : led_(other.led_) {
+    other.led_ = nullptr;
+}
+
+StateIndicator& StateIndicator::operator=(StateIndicator&& other) noexcept {
+    if (this != &other) {
+        if (led_) lv_obj_delete(led_);
+        led_ = other.led_;
+        other.led_ = nullptr;
+    }
+    return *this;
 }
 
 // Fluent setters
 StateIndicator& StateIndicator::color(State state, uint32_t c) & {
-    colors_[static_cast<int>(state)] = c;
-    if (current_state_ == state) {
-        applyState();
+    if (!led_) return *this;
+    IndicatorData* data = dataOf(led_);
+    data->colors_[static_cast<int>(state)] = c;
+    if (data->current_state_ == state) {
+        data->applyState(led_);
     }
     return *this;
 }
@@ -90,9 +137,11 @@ StateIndicator StateIndicator::color(State state, uint32_t c) && {
 }
 
 StateIndicator& StateIndicator::opacity(State state, lv_opa_t opa) & {
-    opacities_[static_cast<int>(state)] = opa;
-    if (current_state_ == state) {
-        applyState();
+    if (!led_) return *this;
+    IndicatorData* data = dataOf(led_);
+    data->opacities_[static_cast<int>(state)] = opa;
+    if (data->current_state_ == state) {
+        data->applyState(led_);
     }
     return *this;
 }
@@ -102,9 +151,25 @@ StateIndicator StateIndicator::opacity(State state, lv_opa_t opa) && {
 }
 
 void StateIndicator::setState(State state) {
-    if (current_state_ == state) return;
-    current_state_ = state;
-    applyState();
+    OC_UI_STAT(StateIndicator, SetterCalls);
+    if (!led_) return;
+    IndicatorData* data = dataOf(led_);
+    if (data->current_state_ == state) return;
+    OC_UI_STAT(StateIndicator, SetterChanges);
+    data->current_state_ = state;
+    // Hidden: only the state is stored, colors follow once visible
+    if (deferred::isHidden(led_)) {
+        if (!data->deferred_) {
+            data->deferred_ = deferred::defer(led_, applyDeferred, led_);
+            if (data->deferred_) OC_UI_STAT(StateIndicator, Deferred);
+        }
+        if (data->deferred_) return;
+    }
+    data->applyState(led_);
+}
+
+StateIndicator::State StateIndicator::getState() const {
+    return led_ ? dataOf(led_)->current_state_ : State::OFF;
 }
 
 }  // namespace oc::ui::lvgl
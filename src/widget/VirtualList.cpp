@@ -2,6 +2,10 @@
 
 #include <algorithm>
 
+#include <oc/ui/lvgl/Deferred.hpp>
+#include <oc/ui/lvgl/LeanObject.hpp>
+#include <oc/ui/lvgl/Stats.hpp>
+#include <oc/ui/lvgl/Trace.hpp>
 #include <oc/ui/lvgl/theme/BaseTheme.hpp>
 
 namespace oc::ui::lvgl::widget {
@@ -59,6 +63,7 @@ VirtualList::VirtualList(VirtualList&& other) noexcept
     , itemGap_(other.itemGap_)
     , marginH_(other.marginH_)
     , animRunning_(other.animRunning_) {
+    relinkCallbacks(&other);
     other.container_ = nullptr;
     other.parent_ = nullptr;
     other.animRunning_ = false;
@@ -98,6 +103,7 @@ VirtualList& VirtualList::operator=(VirtualList&& other) noexcept {
         itemGap_ = other.itemGap_;
         marginH_ = other.marginH_;
         animRunning_ = other.animRunning_;
+        relinkCallbacks(&other);
 
         other.container_ = nullptr;
         other.parent_ = nullptr;
@@ -111,6 +117,9 @@ VirtualList& VirtualList::operator=(VirtualList&& other) noexcept {
 // ══════════════════════════════════════════════════════════════════════════════
 
 VirtualList& VirtualList::visibleCount(int count) {
+#if OC_UI_LVGL_STATIC_ALLOC
+    count = std::min(count, static_cast<int>(VirtualSlotArray::capacity()));
+#endif
     if (count > 0 && count != visibleCount_) {
         visibleCount_ = count;
         if (initialized_) {
@@ -225,7 +234,9 @@ VirtualList& VirtualList::onUpdateHighlight(UpdateHighlightCallback callback) {
 // ══════════════════════════════════════════════════════════════════════════════
 
 bool VirtualList::setTotalCount(int count) {
+    OC_UI_STAT(VirtualList, SetterCalls);
     bool changed = (totalCount_ != count);
+    if (changed) OC_UI_STAT(VirtualList, SetterChanges);
     totalCount_ = count;
 
     if (selectedIndex_ >= totalCount_) {
@@ -248,8 +259,10 @@ bool VirtualList::setTotalCount(int count) {
 void VirtualList::setSelectedIndex(int index) {
     if (totalCount_ == 0) return;
 
+    OC_UI_STAT(VirtualList, SetterCalls);
     index = std::clamp(index, 0, totalCount_ - 1);
     if (selectedIndex_ == index) return;
+    OC_UI_STAT(VirtualList, SetterChanges);
 
     int oldIndex = selectedIndex_;
     selectedIndex_ = index;
@@ -269,6 +282,7 @@ void VirtualList::invalidateIndex(int logicalIndex) {
         VirtualSlot& slot = slots_[slotIdx];
         bool isSelected = (logicalIndex == selectedIndex_);
         onBindSlot_(slot, logicalIndex, isSelected);
+        OC_UI_STAT(VirtualList, Binds);
     }
 }
 
@@ -296,6 +310,7 @@ void VirtualList::show() {
         }
 
         rebindAllSlots();
+        deferred::flush();  // Widgets updated while hidden
     }
 }
 
@@ -311,13 +326,10 @@ void VirtualList::hide() {
 // ══════════════════════════════════════════════════════════════════════════════
 
 void VirtualList::createContainer() {
-    container_ = lv_obj_create(parent_);
+    container_ = lean::create(parent_);
     lv_obj_set_size(container_, LV_PCT(100), LV_PCT(100));
     lv_obj_set_flex_grow(container_, 1);
 
-    lv_obj_set_style_bg_opa(container_, LV_OPA_TRANSP, LV_STATE_DEFAULT);
-    lv_obj_set_style_border_width(container_, 0, LV_STATE_DEFAULT);
-
     lv_obj_set_style_pad_all(container_, padding_, LV_STATE_DEFAULT);
     lv_obj_set_style_pad_row(container_, itemGap_, LV_STATE_DEFAULT);
     lv_obj_set_style_margin_left(container_, marginH_, LV_STATE_DEFAULT);
@@ -326,7 +338,6 @@ void VirtualList::createContainer() {
     lv_obj_set_flex_flow(container_, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_flex_align(container_, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
-    lv_obj_clear_flag(container_, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_add_flag(container_, LV_OBJ_FLAG_HIDDEN);
 
     // Listen for size changes for auto-sizing
@@ -349,13 +360,10 @@ void VirtualList::createSlots() {
     for (int i = 0; i < visibleCount_; i++) {
         VirtualSlot slot;
 
-        slot.container = lv_obj_create(container_);
+        slot.container = lean::create(container_);
         lv_obj_set_width(slot.container, LV_PCT(100));
         lv_obj_set_height(slot.container, height);
 
-        lv_obj_set_style_bg_opa(slot.container, LV_OPA_TRANSP, LV_STATE_DEFAULT);
-        lv_obj_set_style_border_width(slot.container, 0, LV_STATE_DEFAULT);
-
         lv_obj_set_style_pad_left(slot.container, base_theme::layout::PAD_BUTTON_H, LV_STATE_DEFAULT);
         lv_obj_set_style_pad_right(slot.container, base_theme::layout::MARGIN_LG, LV_STATE_DEFAULT);
         lv_obj_set_style_pad_top(slot.container, base_theme::layout::PAD_BUTTON_V, LV_STATE_DEFAULT);
@@ -365,7 +373,6 @@ void VirtualList::createSlots() {
         lv_obj_set_flex_flow(slot.container, LV_FLEX_FLOW_ROW);
         lv_obj_set_flex_align(slot.container, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
-        lv_obj_clear_flag(slot.container, LV_OBJ_FLAG_SCROLLABLE);
         lv_obj_add_flag(slot.container, LV_OBJ_FLAG_HIDDEN);
 
         slot.boundIndex = -1;
@@ -392,6 +399,7 @@ void VirtualList::recalculateItemHeight() {
     int calculatedHeight = availableHeight / visibleCount_;
 
     if (calculatedHeight > 0 && calculatedHeight != itemHeight_) {
+        OC_UI_STAT(VirtualList, Geometry);
         itemHeight_ = calculatedHeight;
 
         // Update existing slot heights
@@ -434,6 +442,7 @@ int VirtualList::logicalIndexToSlotIndex(int logicalIndex) const {
 
 void VirtualList::rebindAllSlots() {
     if (!onBindSlot_ || totalCount_ == 0) return;
+    OC_UI_TRACE_SCOPE("VirtualList::rebindAllSlots");
 
     int newWindowStart = calculateWindowStart();
     windowStart_ = newWindowStart;
@@ -445,8 +454,9 @@ void VirtualList::rebindAllSlots() {
         if (logicalIndex < totalCount_) {
             slot.boundIndex = logicalIndex;
             bool isSelected = (logicalIndex == selectedIndex_);
+            lv_obj_clear_flag(slot.container, LV_OBJ_FLAG_HIDDEN);  // Before binding: no deferred updates
             onBindSlot_(slot, logicalIndex, isSelected);
-            lv_obj_clear_flag(slot.container, LV_OBJ_FLAG_HIDDEN);
+            OC_UI_STAT(VirtualList, Binds);
         } else {
             slot.boundIndex = -1;
             lv_obj_add_flag(slot.container, LV_OBJ_FLAG_HIDDEN);
@@ -479,6 +489,7 @@ void VirtualList::updateHighlightOnly(int oldIndex, int newIndex) {
         onUpdateHighlight_(slots_[oldSlotIdx], false);
     } else if (oldSlotIdx >= 0 && onBindSlot_) {
         onBindSlot_(slots_[oldSlotIdx], oldIndex, false);
+        OC_UI_STAT(VirtualList, Binds);
     }
 
     // Activate new highlight (if visible)
@@ -487,6 +498,7 @@ void VirtualList::updateHighlightOnly(int oldIndex, int newIndex) {
         onUpdateHighlight_(slots_[newSlotIdx], true);
     } else if (newSlotIdx >= 0 && onBindSlot_) {
         onBindSlot_(slots_[newSlotIdx], newIndex, true);
+        OC_UI_STAT(VirtualList, Binds);
     }
 
     previousSelectedIndex_ = newIndex;
@@ -497,6 +509,7 @@ void VirtualList::rebindSlot(VirtualSlot& slot, int newIndex) {
     bool isSelected = (newIndex == selectedIndex_);
     if (onBindSlot_) {
         onBindSlot_(slot, newIndex, isSelected);
+        OC_UI_STAT(VirtualList, Binds);
     }
 }
 
@@ -505,6 +518,7 @@ void VirtualList::updateSlotHighlight(VirtualSlot& slot, bool isSelected) {
         onUpdateHighlight_(slot, isSelected);
     } else if (onBindSlot_ && slot.boundIndex >= 0) {
         onBindSlot_(slot, slot.boundIndex, isSelected);
+        OC_UI_STAT(VirtualList, Binds);
     }
 }
 
@@ -528,6 +542,14 @@ void VirtualList::scrollAnimCallback(void* var, int32_t value) {
 // Private: Event Handlers
 // ══════════════════════════════════════════════════════════════════════════════
 
+void VirtualList::relinkCallbacks(void* previous) {
+    // The size event holds `this`: re-point it at the moved-to object
+    if (container_) {
+        lv_obj_remove_event_cb_with_user_data(container_, sizeChangedCallback, previous);
+        lv_obj_add_event_cb(container_, sizeChangedCallback, LV_EVENT_SIZE_CHANGED, this);
+    }
+}
+
 void VirtualList::sizeChangedCallback(lv_event_t* e) {
     auto* self = static_cast<VirtualList*>(lv_event_get_user_data(e));
     if (self && self->autoSizing_) {